@@ -21,6 +21,13 @@
 #define LV_EX_KEYBOARD     0       /*Add PC keyboard support to some examples (`lv_drivers` repository is required)*/
 #define LV_EX_MOUSEWHEEL   0       /*Add 'encoder' (mouse wheel) support to some examples (`lv_drivers` repository is required)*/
 
+/*Load the music demo's images from an asset pack (see src/assets/lv_demo_pack.h) instead of compiling them in*/
+#define LV_DEMO_USE_PACK   0
+
+/*Decode the compressed images (see src/assets/lv_demo_img_compr.h) with a cache of the decoded images [bytes]*/
+#define LV_DEMO_USE_IMG_COMPR          0
+#define LV_DEMO_IMG_COMPR_CACHE_SIZE   (128 * 1024)
+
 /*********************
  * DEMO USAGE
  *********************/
@@ -39,9 +46,27 @@
 
 /*Benchmark your system*/
 #define LV_USE_DEMO_BENCHMARK   0
+#if LV_USE_DEMO_BENCHMARK
+/*Path of the files used in the "Image cache file" scene. `%d` is replaced by 0, 1, 2... (up to 31)
+ *Leave it commented to skip the scene*/
+//# define LV_DEMO_BENCHMARK_IMG_CACHE_FILE_FMT   "S:img_cogwheel_%d.bin"
+
+/*Size of the glyph bitmap cache in the "Text ... compressed cached" scenes [bytes]*/
+# define LV_DEMO_BENCHMARK_GLYPH_CACHE_SIZE     (8 * 1024)
+#endif
 
 /*Stress test for LVGL*/
 #define LV_USE_DEMO_STRESS      0
+#if LV_USE_DEMO_STRESS
+/*Stop after this many cycles and check the trend of the used memory. 0: run forever*/
+# define LV_DEMO_STRESS_CYCLES          0
+
+/*Max. leaked memory to pass [bytes / 1000 cycles]*/
+# define LV_DEMO_STRESS_LEAK_LIMIT      100
+
+/*Max. depth of the deep trees of the tree mode. Every level needs a few hundred bytes of stack*/
+# define LV_DEMO_STRESS_TREE_DEPTH_MAX  1000
+#endif
 
 /*Music player demo*/
 #define LV_USE_DEMO_MUSIC      1
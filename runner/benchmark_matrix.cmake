@@ -0,0 +1,48 @@
+# Build the headless runner for every color format, run the benchmark with each and
+# compare the results to the 32 bit build.
+# Called by the `benchmark_matrix` target in script mode (cmake -P).
+
+set(CONFIGS "32" "16" "16swap" "8" "1")
+separate_arguments(RUNNER_ARGS)
+
+foreach(cfg ${CONFIGS})
+    if(cfg STREQUAL "16swap")
+        set(CFG_ARGS -DLV_DEMO_COLOR_DEPTH=16 -DLV_DEMO_COLOR_16_SWAP=ON)
+    else()
+        set(CFG_ARGS -DLV_DEMO_COLOR_DEPTH=${cfg} -DLV_DEMO_COLOR_16_SWAP=OFF)
+    endif()
+
+    message(STATUS "Building the benchmark for ${cfg} bit colors")
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} -S ${SOURCE_DIR} -B ${BINARY_DIR}/${cfg}
+            -DLV_DEMO_BUILD_RUNNER=ON -DLVGL_DIR=${LVGL_DIR} -DCMAKE_BUILD_TYPE=${BUILD_TYPE} ${CFG_ARGS}
+        OUTPUT_QUIET
+        RESULT_VARIABLE res)
+    if(NOT res EQUAL 0)
+        message(FATAL_ERROR "Configuring the ${cfg} bit build failed")
+    endif()
+
+    execute_process(
+        COMMAND ${CMAKE_COMMAND} --build ${BINARY_DIR}/${cfg} --target lv_demo_runner
+        OUTPUT_QUIET
+        RESULT_VARIABLE res)
+    if(NOT res EQUAL 0)
+        message(FATAL_ERROR "Building the ${cfg} bit runner failed")
+    endif()
+
+    message(STATUS "Running the benchmark with ${cfg} bit colors")
+    execute_process(
+        COMMAND ${BINARY_DIR}/${cfg}/runner/lv_demo_runner --demo benchmark ${RUNNER_ARGS}
+        OUTPUT_FILE ${BINARY_DIR}/${cfg}.csv
+        RESULT_VARIABLE res)
+    if(NOT res EQUAL 0)
+        message(FATAL_ERROR "The ${cfg} bit benchmark failed")
+    endif()
+endforeach()
+
+foreach(cfg ${CONFIGS})
+    if(NOT cfg STREQUAL "32")
+        message(STATUS "${cfg} bit compared to 32 bit (${BINARY_DIR}/${cfg}.csv)")
+        execute_process(COMMAND python3 ${SOURCE_DIR}/scripts/benchmark_compare.py ${BINARY_DIR}/32.csv ${BINARY_DIR}/${cfg}.csv)
+    endif()
+endforeach()
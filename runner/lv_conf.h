@@ -0,0 +1,68 @@
+/**
+ * @file lv_conf.h
+ * LVGL configuration of the headless demo runner.
+ * Only the settings which differ from the defaults (see `lv_conf_internal.h`) are set.
+ */
+
+/* clang-format off */
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+/*====================
+   COLOR SETTINGS
+ *====================*/
+#ifndef LV_COLOR_DEPTH
+#define LV_COLOR_DEPTH      32
+#endif
+
+#ifndef LV_COLOR_16_SWAP
+#define LV_COLOR_16_SWAP    0
+#endif
+
+/*=========================
+   MEMORY SETTINGS
+ *=========================*/
+#define LV_MEM_CUSTOM       0
+#define LV_MEM_SIZE         (32U * 1024U * 1024U)   /*LVGL's own heap to measure it. Large for the 50000 object trees of the stress demo.*/
+
+/*====================
+   HAL SETTINGS
+ *====================*/
+#define LV_DISP_DEF_REFR_PERIOD     10
+#define LV_INDEV_DEF_READ_PERIOD    10
+
+#define LV_TICK_CUSTOM      1
+#define LV_TICK_CUSTOM_INCLUDE  "lv_drv_headless_tick.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR (lv_drv_headless_tick_get())
+
+/*=======================
+ * FEATURE CONFIGURATION
+ *=======================*/
+#define LV_IMG_CACHE_DEF_SIZE   4
+
+#define LV_USE_LOG          1
+#define LV_LOG_LEVEL        LV_LOG_LEVEL_USER
+#define LV_LOG_PRINTF       1
+
+#define LV_USE_ASSERT_NULL          1
+#define LV_USE_ASSERT_MALLOC        1
+
+/*==================
+ *   FONT USAGE
+ *===================*/
+#define LV_FONT_MONTSERRAT_12   1
+#define LV_FONT_MONTSERRAT_14   1
+#define LV_FONT_MONTSERRAT_16   1
+#define LV_FONT_MONTSERRAT_18   1
+#define LV_FONT_MONTSERRAT_20   1
+#define LV_FONT_MONTSERRAT_22   1
+#define LV_FONT_MONTSERRAT_24   1
+#define LV_FONT_MONTSERRAT_28   1
+#define LV_FONT_MONTSERRAT_32   1
+
+/*==================
+ * EXTRA COMPONENTS
+ *==================*/
+#define LV_USE_THEME_DEFAULT    1
+
+#endif /*LV_CONF_H*/
@@ -0,0 +1,40 @@
+/**
+ * @file lv_demo_conf.h
+ * Demo configuration of the headless demo runner
+ */
+
+/* clang-format off */
+#ifndef LV_DEMO_CONF_H
+#define LV_DEMO_CONF_H
+
+/*******************
+ * GENERAL SETTING
+ *******************/
+#define LV_EX_PRINTF       1
+#define LV_EX_KEYBOARD     0
+#define LV_EX_MOUSEWHEEL   0
+#define LV_DEMO_USE_PACK   0
+#define LV_DEMO_USE_IMG_COMPR   0
+
+/*********************
+ * DEMO USAGE
+ *********************/
+#define LV_USE_DEMO_WIDGETS        1
+#define LV_DEMO_WIDGETS_SLIDESHOW  0
+
+#define LV_USE_DEMO_KEYPAD_AND_ENCODER     1
+
+#define LV_USE_DEMO_BENCHMARK   1
+
+#define LV_USE_DEMO_STRESS      1
+#define LV_DEMO_STRESS_CYCLES   20
+#define LV_DEMO_STRESS_TREE_DEPTH_MAX   10000   /*A few MB of stack, well within the 8 MB of the main thread on Linux*/
+
+#define LV_USE_DEMO_MUSIC      1
+#define LV_DEMO_MUSIC_SQUARE       0
+#define LV_DEMO_MUSIC_LANDSCAPE    0
+#define LV_DEMO_MUSIC_ROUND        0
+#define LV_DEMO_MUSIC_LARGE        0
+#define LV_DEMO_MUSIC_AUTO_PLAY    1
+
+#endif /*LV_DEMO_CONF_H*/
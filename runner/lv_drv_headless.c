@@ -0,0 +1,190 @@
+/**
+ * @file lv_drv_headless.c
+ * A display driver without display: renders into a frame buffer in the memory.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#define _POSIX_C_SOURCE 200809L
+#include "lv_drv_headless.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+static void refr_timer_cb(lv_timer_t * timer);
+static void bus_model(uint32_t px_cnt);
+static uint64_t mono_time_ns(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_disp_drv_t disp_drv;
+static lv_disp_draw_buf_t draw_buf;
+static lv_color_t * fb;
+static uint32_t frame_cnt;
+static bool virtual_tick;
+static uint32_t virtual_ms;
+static lv_drv_headless_bus_t bus;
+static lv_drv_headless_bus_stat_t bus_stat;
+static uint64_t bus_busy_ns;        /*Remaining time of the last transfer when the flush returned*/
+static uint64_t bus_render_start;   /*When the rendering of the next area started*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t lv_drv_headless_tick_get(void)
+{
+    static uint64_t start_ms = 0;
+
+    if(virtual_tick) return virtual_ms;
+
+    uint64_t now_ms = mono_time_ns() / 1000000;
+    if(start_ms == 0) start_ms = now_ms;
+
+    return (uint32_t)(now_ms - start_ms);
+}
+
+void lv_drv_headless_tick_set_virtual(bool en)
+{
+    /*Continue from the current time to not confuse the already running timers*/
+    if(en && !virtual_tick) virtual_ms = lv_drv_headless_tick_get();
+    virtual_tick = en;
+}
+
+void lv_drv_headless_tick_inc(uint32_t ms)
+{
+    virtual_ms += ms;
+}
+
+lv_disp_t * lv_drv_headless_init(lv_coord_t hor_res, lv_coord_t ver_res, lv_coord_t buf_lines)
+{
+    /*Allocated from the system's heap to not use the LVGL's heap*/
+    fb = calloc((size_t)hor_res * ver_res, sizeof(lv_color_t));
+    lv_color_t * buf = malloc((size_t)hor_res * buf_lines * sizeof(lv_color_t));
+    lv_color_t * buf2 = bus.dma ? malloc((size_t)hor_res * buf_lines * sizeof(lv_color_t)) : NULL;
+    if(fb == NULL || buf == NULL || (bus.dma && buf2 == NULL)) {
+        free(fb);
+        free(buf);
+        free(buf2);
+        fb = NULL;
+        return NULL;
+    }
+
+    lv_disp_draw_buf_init(&draw_buf, buf, buf2, (uint32_t)hor_res * buf_lines);
+
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = hor_res;
+    disp_drv.ver_res = ver_res;
+    disp_drv.draw_buf = &draw_buf;
+    disp_drv.flush_cb = flush_cb;
+
+    lv_disp_t * disp = lv_disp_drv_register(&disp_drv);
+    if(disp == NULL) return NULL;
+
+    /*Wrap the refresh to know when the rendering starts, there is no callback for it*/
+    lv_timer_set_cb(disp->refr_timer, refr_timer_cb);
+
+    return disp;
+}
+
+void lv_drv_headless_set_bus(const lv_drv_headless_bus_t * new_bus)
+{
+    bus = *new_bus;
+    if(bus.bpp == 0) bus.bpp = LV_COLOR_DEPTH;
+}
+
+void lv_drv_headless_get_bus_stat(lv_drv_headless_bus_stat_t * stat)
+{
+    *stat = bus_stat;
+}
+
+const lv_color_t * lv_drv_headless_get_fb(void)
+{
+    return fb;
+}
+
+uint32_t lv_drv_headless_get_frame_cnt(void)
+{
+    return frame_cnt;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    /*With software rotation the area is already rotated to the panel's coordinates*/
+    lv_coord_t fb_w = drv->hor_res;
+    lv_coord_t w = lv_area_get_width(area);
+
+    lv_coord_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        memcpy(&fb[(size_t)y * fb_w + area->x1], color_p, w * sizeof(lv_color_t));
+        color_p += w;
+    }
+
+    if(bus.kbit_per_sec) bus_model(lv_area_get_size(area));
+
+    if(lv_disp_flush_is_last(drv)) frame_cnt++;
+
+    lv_disp_flush_ready(drv);
+}
+
+static void refr_timer_cb(lv_timer_t * timer)
+{
+    /*Don't count the idle time between the refreshes (timer sleeps, scene changes) as rendering,
+     *the transfer of the previous frame can overlap only with the rendering of this one*/
+    bus_render_start = mono_time_ns();
+    _lv_disp_refr_timer(timer);
+}
+
+static void bus_model(uint32_t px_cnt)
+{
+    uint64_t byte_cnt = ((uint64_t)px_cnt * bus.bpp + 7) >> 3;
+    uint64_t transfer_ns = (uint64_t)bus.overhead_us * 1000 + (byte_cnt * 8 * 1000000) / bus.kbit_per_sec;
+
+    bus_stat.flush_cnt++;
+    bus_stat.byte_cnt += byte_cnt;
+    bus_stat.bus_ns += transfer_ns;
+
+    uint64_t now = mono_time_ns();
+    if(bus.dma) {
+        /*Rendering of this area could run parallel with the previous transfer.
+         *Wait only for the part of the previous transfer which was longer than the rendering*/
+        uint64_t render_ns = now - bus_render_start;
+        if(bus_busy_ns > render_ns) bus_stat.stall_ns += bus_busy_ns - render_ns;
+        bus_busy_ns = transfer_ns;
+    } else {
+        /*The CPU is blocked during the whole transfer*/
+        bus_stat.stall_ns += transfer_ns;
+    }
+
+    /*Measure the rendering of the next area from here to not count the time of the model*/
+    bus_render_start = mono_time_ns();
+}
+
+static uint64_t mono_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file lv_drv_headless.h
+ *
+ */
+
+#ifndef LV_DRV_HEADLESS_H
+#define LV_DRV_HEADLESS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+#include "lv_drv_headless_tick.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Model of the bus between the MCU and the display controller (e.g. SPI or 8080 parallel).
+ * The flushes are still instant, only the time they would take is calculated.
+ */
+typedef struct {
+    uint32_t kbit_per_sec;      /*Bandwidth of the bus. 0: no bus model*/
+    uint32_t overhead_us;       /*Fixed cost of a transaction, e.g. setting the window on the display controller*/
+    uint8_t bpp;                /*Bits per pixel on the bus*/
+    bool dma;                   /*true: 2 draw buffers and the transfer runs parallel with rendering*/
+} lv_drv_headless_bus_t;
+
+typedef struct {
+    uint32_t flush_cnt;         /*Number of transactions*/
+    uint64_t byte_cnt;          /*Transferred bytes*/
+    uint64_t bus_ns;            /*Modelled time of all the transfers*/
+    uint64_t stall_ns;          /*Modelled time while rendering had to wait for the bus*/
+} lv_drv_headless_bus_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a display which renders into an in-memory frame buffer
+ * @param hor_res       horizontal resolution
+ * @param ver_res       vertical resolution
+ * @param buf_lines     number of lines in the draw buffer (`ver_res` for a full screen buffer)
+ * @return              the created display or NULL if there was not enough memory
+ */
+lv_disp_t * lv_drv_headless_init(lv_coord_t hor_res, lv_coord_t ver_res, lv_coord_t buf_lines);
+
+/**
+ * Set the bus model. Should be called before `lv_drv_headless_init()` as DMA mode needs a second draw buffer.
+ * @param bus       pointer to a bus model. Copied so it can be a local variable.
+ */
+void lv_drv_headless_set_bus(const lv_drv_headless_bus_t * bus);
+
+/**
+ * Get the statistics of the bus model
+ * @param stat      store the statistics here
+ */
+void lv_drv_headless_get_bus_stat(lv_drv_headless_bus_stat_t * stat);
+
+/**
+ * Get the frame buffer, i.e. the content of the "panel"
+ * @return      pointer to `hor_res * ver_res` pixels
+ */
+const lv_color_t * lv_drv_headless_get_fb(void);
+
+/**
+ * Get the number of refreshed frames (the last flush of a refresh counts as a frame)
+ * @return      the number of frames
+ */
+uint32_t lv_drv_headless_get_frame_cnt(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DRV_HEADLESS_H*/
@@ -0,0 +1,47 @@
+/**
+ * @file lv_drv_headless_tick.h
+ * Included by LVGL via `LV_TICK_CUSTOM_INCLUDE` so it can't include `lvgl.h`
+ */
+
+#ifndef LV_DRV_HEADLESS_TICK_H
+#define LV_DRV_HEADLESS_TICK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the milliseconds elapsed since the first call. Used as `LV_TICK_CUSTOM_SYS_TIME_EXPR`.
+ * In virtual mode the time advances only by `lv_drv_headless_tick_inc()`.
+ * @return      the elapsed time [ms]
+ */
+uint32_t lv_drv_headless_tick_get(void);
+
+/**
+ * Enable or disable the virtual clock. When enabled the wall-clock time is ignored
+ * and the time is advanced only manually. It makes the runs deterministic and as fast as the CPU allows.
+ * @param en    true: use the virtual clock
+ */
+void lv_drv_headless_tick_set_virtual(bool en);
+
+/**
+ * Advance the virtual clock
+ * @param ms    the milliseconds to add
+ */
+void lv_drv_headless_tick_inc(uint32_t ms);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DRV_HEADLESS_TICK_H*/
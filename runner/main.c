@@ -0,0 +1,874 @@
+/**
+ * @file main.c
+ * Run the demos without a display, e.g. to measure the rendering performance in CI.
+ *
+ * Usage: lv_demo_runner [--demo NAME|all] [--time MS] [--res WxH] [--buf-lines N] [--virtual-tick MS]
+ *                       [--bus-kbps N] [--bus-overhead-us N] [--bus-bpp N] [--bus-dma] [--jobs N]
+ *                       [--golden-write FILE | --golden-check FILE] [--golden-tol N] [--pack FILE]
+ *                       [--seed N] [--fuzz-ops N] [--widget-cnt N] [--tree-max N]
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#define _GNU_SOURCE     /*For the CPU affinity*/
+#include "lv_drv_headless.h"
+#include "runner_golden.h"
+#include "../src/assets/lv_demo_pack.h"
+#include "../src/assets/lv_demo_img_compr.h"
+#include "../lv_demo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <sys/wait.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define DEF_HOR_RES     800
+#define DEF_VER_RES     480
+#define DEF_BUF_LINES   48
+#define DEF_TIME        30000   /*Run the not self-terminating demos for this long [ms]*/
+#define JOBS_MAX        64
+#define DEF_FUZZ_OPS    1000
+#define DEF_WIDGET_CNT  100
+#define DEF_TREE_MAX    50000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const char * name;
+    void (*create_cb)(void);
+} demo_dsc_t;
+
+typedef struct {
+    uint32_t run_time;
+    int hor_res;
+    int ver_res;
+    int buf_lines;
+    uint32_t virtual_step;
+    lv_drv_headless_bus_t bus;
+    const char * pack_path;     /*Asset pack to load, NULL: use the compiled-in images*/
+    uint32_t seed;              /*Seed of the stress test's fuzz mode*/
+    uint32_t fuzz_ops;          /*Operations of the fuzz mode, 0: run for `run_time`*/
+    uint32_t widget_cnt;        /*Instances per widget type in the stress test's widget mode*/
+    uint32_t tree_max;          /*Max. objects in a tree of the stress test's tree mode*/
+} run_opt_t;
+
+/*Statistics of a demo's run*/
+typedef struct {
+    uint32_t startup_us;        /*From the initialization of LVGL to the first frame*/
+    uint32_t frame_cnt;
+    uint32_t frame_avg_us;      /*CPU time per frame*/
+    uint32_t frame_p99_us;
+    uint32_t frame_max_us;
+    uint32_t cpu_ms;            /*CPU time of the whole run*/
+    uint32_t heap_peak;         /*Max. used memory from LVGL's heap [bytes]*/
+} run_stat_t;
+
+/*The bus statistics of a benchmark scene*/
+typedef struct {
+    lv_drv_headless_bus_stat_t bus;
+    uint32_t frame_cnt;
+} scene_bus_t;
+
+/*Sent from the benchmark workers to the main process*/
+typedef struct {
+    uint32_t id;
+    lv_demo_benchmark_result_t res;     /*`res.name` points to a literal so it's valid after `fork()` too*/
+} worker_result_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool lvgl_init(void);
+static int run(const demo_dsc_t * demo, int result_fd, FILE * log, run_stat_t * stat);
+static int run_parallel(const demo_dsc_t * demo, uint32_t jobs);
+static int run_all(void);
+static bool frame_time_add(uint32_t us);
+static int frame_time_cmp(const void * a, const void * b);
+static void pin_to_cpu(uint32_t idx);
+static void demo_finished_cb(void);
+static void benchmark_print(FILE * f, const lv_demo_benchmark_result_t * res, uint32_t cnt);
+static void scene_bus_update(bool force);
+static void scene_bus_print(FILE * f);
+static bool stress_print(FILE * f);
+static void stress_fuzz(void);
+static void stress_widgets(void);
+static void stress_widgets_print(FILE * f);
+static void stress_tree(void);
+static void stress_tree_print(FILE * f);
+static uint32_t clock_us(void);
+static void sleep_ms(uint32_t ms);
+static uint64_t cpu_time_ns(void);
+static uint64_t real_time_ns(void);
+static void print_usage(const char * prog);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*In the order of `--demo all`*/
+static const demo_dsc_t demos[] = {
+#if LV_USE_DEMO_WIDGETS
+    {.name = "widgets",         .create_cb = lv_demo_widgets},
+#endif
+#if LV_USE_DEMO_MUSIC
+    {.name = "music",           .create_cb = lv_demo_music},
+#endif
+#if LV_USE_DEMO_STRESS
+    {.name = "stress",          .create_cb = lv_demo_stress},
+    {.name = "stress_fuzz",     .create_cb = stress_fuzz},
+    {.name = "stress_widgets",  .create_cb = stress_widgets},
+    {.name = "stress_tree",     .create_cb = stress_tree},
+#endif
+#if LV_USE_DEMO_KEYPAD_AND_ENCODER
+    {.name = "keypad_encoder",  .create_cb = lv_demo_keypad_encoder},
+#endif
+#if LV_USE_DEMO_BENCHMARK
+    {.name = "benchmark",       .create_cb = lv_demo_benchmark},
+#endif
+    {.name = NULL,              .create_cb = NULL}
+};
+
+static volatile bool finished;
+static uint32_t * frame_times;  /*CPU time of every frame [us] to get the percentiles*/
+static uint32_t frame_times_cnt;
+static uint32_t frame_times_size;
+static scene_bus_t * scene_bus;             /*Per scene of the benchmark, NULL: no bus model or not the benchmark*/
+static int32_t scene_bus_act;               /*The scene of `scene_bus_start`*/
+static lv_drv_headless_bus_stat_t scene_bus_start;
+static uint32_t scene_bus_frame_start;
+static run_opt_t opt = {
+    .run_time = DEF_TIME,
+    .hor_res = DEF_HOR_RES,
+    .ver_res = DEF_VER_RES,
+    .buf_lines = DEF_BUF_LINES,
+    .seed = 1,
+    .fuzz_ops = DEF_FUZZ_OPS,
+    .widget_cnt = DEF_WIDGET_CNT,
+    .tree_max = DEF_TREE_MAX,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    const char * demo_name = "benchmark";
+    uint32_t jobs = 1;
+    const char * golden_path = NULL;
+    bool golden_write = false;
+    uint32_t golden_tol = 0;
+
+    int i;
+    for(i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--demo") == 0 && i + 1 < argc) demo_name = argv[++i];
+        else if(strcmp(argv[i], "--time") == 0 && i + 1 < argc) opt.run_time = strtoul(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--res") == 0 && i + 1 < argc) {
+            if(sscanf(argv[++i], "%dx%d", &opt.hor_res, &opt.ver_res) != 2) {
+                print_usage(argv[0]);
+                return 1;
+            }
+        }
+        else if(strcmp(argv[i], "--buf-lines") == 0 && i + 1 < argc) opt.buf_lines = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--virtual-tick") == 0 && i + 1 < argc) opt.virtual_step = strtoul(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--bus-kbps") == 0 && i + 1 < argc) opt.bus.kbit_per_sec = strtoul(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--bus-overhead-us") == 0 && i + 1 < argc) opt.bus.overhead_us = strtoul(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--bus-bpp") == 0 && i + 1 < argc) opt.bus.bpp = atoi(argv[++i]);
+        else if(strcmp(argv[i], "--bus-dma") == 0) opt.bus.dma = true;
+        else if(strcmp(argv[i], "--jobs") == 0 && i + 1 < argc) jobs = strtoul(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--golden-write") == 0 && i + 1 < argc) {
+            golden_path = argv[++i];
+            golden_write = true;
+        }
+        else if(strcmp(argv[i], "--golden-check") == 0 && i + 1 < argc) {
+            golden_path = argv[++i];
+            golden_write = false;
+        }
+        else if(strcmp(argv[i], "--golden-tol") == 0 && i + 1 < argc) golden_tol = strtoul(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--seed") == 0 && i + 1 < argc) opt.seed = strtoul(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--fuzz-ops") == 0 && i + 1 < argc) opt.fuzz_ops = strtoul(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--widget-cnt") == 0 && i + 1 < argc) opt.widget_cnt = strtoul(argv[++i], NULL, 10);
+        else if(strcmp(argv[i], "--tree-max") == 0 && i + 1 < argc) opt.tree_max = strtoul(argv[++i], NULL, 10);
+#if LV_DEMO_USE_PACK
+        else if(strcmp(argv[i], "--pack") == 0 && i + 1 < argc) opt.pack_path = argv[++i];
+#endif
+        else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    const demo_dsc_t * demo = NULL;
+    for(i = 0; demos[i].name; i++) {
+        if(strcmp(demos[i].name, demo_name) == 0) demo = &demos[i];
+    }
+
+    bool all = strcmp(demo_name, "all") == 0;
+    if((demo == NULL && !all) || opt.hor_res <= 0 || opt.ver_res <= 0 || opt.buf_lines <= 0 || jobs == 0 || jobs > JOBS_MAX) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    if(opt.buf_lines > opt.ver_res) opt.buf_lines = opt.ver_res;
+
+    /*The golden check always runs on the virtual clock to get the same animation states*/
+    if(golden_path) {
+        if(opt.virtual_step == 0) opt.virtual_step = 1;
+        if(!lvgl_init()) return 1;
+        return runner_golden_run(golden_path, golden_write, golden_tol);
+    }
+
+    if(all) return run_all();
+
+#if LV_USE_DEMO_BENCHMARK
+    /*Only the benchmark's scenes can be split between the workers*/
+    if(jobs > 1 && demo->create_cb == lv_demo_benchmark) return run_parallel(demo, jobs);
+#endif
+
+    run_stat_t stat;
+    return run(demo, -1, stdout, &stat);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Initialize LVGL and the headless display according to `opt`
+ * @return      false: the frame buffer couldn't be allocated or the asset pack couldn't be loaded
+ */
+static bool lvgl_init(void)
+{
+    /*Enable the virtual clock before anything reads the tick*/
+    if(opt.virtual_step) lv_drv_headless_tick_set_virtual(true);
+
+    lv_init();
+    lv_drv_headless_set_bus(&opt.bus);
+    if(lv_drv_headless_init(opt.hor_res, opt.ver_res, opt.buf_lines) == NULL) {
+        fprintf(stderr, "Couldn't allocate the frame buffer\n");
+        return false;
+    }
+
+#if LV_DEMO_USE_PACK
+    if(opt.pack_path && !lv_demo_pack_open(opt.pack_path)) {
+        fprintf(stderr, "Couldn't load the asset pack %s\n", opt.pack_path);
+        return false;
+    }
+#endif
+
+    return true;
+}
+
+/**
+ * Run a demo in the current process
+ * @param demo          the demo to run
+ * @param result_fd     write the benchmark's results here as `worker_result_t`s. -1: print them as CSV.
+ * @param log           print the statistics here
+ * @param stat          store the statistics here
+ * @return              exit code
+ */
+static int run(const demo_dsc_t * demo, int result_fd, FILE * log, run_stat_t * stat)
+{
+    uint32_t run_time = opt.run_time;
+    uint64_t startup_start = real_time_ns();
+
+    lv_memset_00(stat, sizeof(run_stat_t));
+    frame_times_cnt = 0;
+
+    if(!lvgl_init()) return 1;
+
+#if LV_USE_DEMO_BENCHMARK
+    /*The benchmark finishes by itself, run it until it's ready*/
+    if(demo->create_cb == lv_demo_benchmark) {
+        lv_demo_benchmark_set_finished_cb(demo_finished_cb);
+        run_time = UINT32_MAX;
+
+        /*Report the bus per scene as the scenes load the bus very differently*/
+        if(opt.bus.kbit_per_sec) {
+            scene_bus = calloc(lv_demo_benchmark_get_scene_cnt(), sizeof(scene_bus_t));
+            scene_bus_act = -1;
+        }
+    }
+
+    /*The tick is too coarse for a reflow, an image decode or a draw case and doesn't advance in virtual mode*/
+    lv_demo_benchmark_set_clock_cb(clock_us);
+#endif
+
+#if LV_USE_DEMO_STRESS
+    /*With a cycle count the stress test finishes by itself and checks the memory trend*/
+    if((demo->create_cb == lv_demo_stress && LV_DEMO_STRESS_CYCLES) || (demo->create_cb == stress_fuzz && opt.fuzz_ops) ||
+       demo->create_cb == stress_widgets || demo->create_cb == stress_tree) {
+        lv_demo_stress_set_finished_cb(demo_finished_cb);
+        run_time = UINT32_MAX;
+    }
+
+    /*The tick is too coarse for the creation of a widget and doesn't advance in virtual mode*/
+    lv_demo_stress_set_clock_cb(clock_us);
+#endif
+#if LV_DEMO_USE_IMG_COMPR
+    lv_demo_img_compr_set_clock_cb(clock_us);
+#endif
+
+    demo->create_cb();
+
+    /*Measure the CPU time spent in LVGL and assign it to the frame which was finished*/
+    uint64_t frame_cpu = 0;
+    uint64_t frame_cpu_sum = 0;
+    uint64_t frame_cpu_max = 0;
+    uint32_t frame_cnt_prev = lv_drv_headless_get_frame_cnt();
+    uint64_t cpu_start = cpu_time_ns();
+
+    uint32_t start = lv_tick_get();
+    while(!finished && lv_tick_elaps(start) < run_time) {
+        uint64_t t = cpu_time_ns();
+        uint32_t wait = lv_timer_handler();
+        frame_cpu += cpu_time_ns() - t;
+
+        if(scene_bus) scene_bus_update(false);
+
+        uint32_t frame_cnt = lv_drv_headless_get_frame_cnt();
+        if(frame_cnt != frame_cnt_prev) {
+            /*Several frames in one call are unlikely, but split the time evenly then*/
+            uint64_t cpu_per_frame = frame_cpu / (frame_cnt - frame_cnt_prev);
+            frame_cpu_sum += frame_cpu;
+            if(cpu_per_frame > frame_cpu_max) frame_cpu_max = cpu_per_frame;
+            if(frame_cnt_prev == 0) stat->startup_us = (uint32_t)((real_time_ns() - startup_start) / 1000);
+            uint32_t f;
+            for(f = frame_cnt_prev; f < frame_cnt; f++) frame_time_add((uint32_t)(cpu_per_frame / 1000));
+            frame_cpu = 0;
+            frame_cnt_prev = frame_cnt;
+        }
+
+        /*In virtual mode don't wait but jump in time*/
+        if(opt.virtual_step) lv_drv_headless_tick_inc(opt.virtual_step);
+        else sleep_ms(LV_MIN(wait, 1));
+    }
+
+    uint64_t cpu_total = cpu_time_ns() - cpu_start;
+
+#if LV_USE_DEMO_BENCHMARK
+    if(demo->create_cb == lv_demo_benchmark) {
+        uint32_t cnt = lv_demo_benchmark_get_scene_cnt();
+        if(result_fd >= 0) {
+            /*Send only the scenes of this worker, the others have no results*/
+            worker_result_t wr;
+            for(wr.id = 0; wr.id < cnt; wr.id++) {
+                lv_demo_benchmark_get_result(wr.id, &wr.res);
+                if(wr.res.refr_cnt_normal == 0 && wr.res.refr_cnt_opa == 0) continue;
+                if(write(result_fd, &wr, sizeof(wr)) != sizeof(wr)) return 1;
+            }
+        } else {
+            lv_demo_benchmark_result_t * res = malloc(cnt * sizeof(lv_demo_benchmark_result_t));
+            if(res == NULL) return 1;
+            uint32_t i;
+            for(i = 0; i < cnt; i++) lv_demo_benchmark_get_result(i, &res[i]);
+            benchmark_print(log, res, cnt);
+            free(res);
+        }
+    }
+#else
+    LV_UNUSED(result_fd);
+#endif
+
+    int ret = 0;
+#if LV_USE_DEMO_STRESS
+    if(demo->create_cb == lv_demo_stress && LV_DEMO_STRESS_CYCLES) {
+        if(!stress_print(log)) ret = 1;
+    }
+    if(demo->create_cb == stress_fuzz) {
+        lv_demo_stress_fuzz_result_t res;
+        lv_demo_stress_fuzz_get_result(&res);
+        fprintf(log, "Fuzz: %s, seed %d, %d operations, %d heap checks, %d bytes not freed, frag: %d %%\n",
+                res.mem_error ? "FAILED" : "passed", res.seed, res.op_cnt, res.mem_test_cnt, res.leak_total, res.frag_pct);
+        if(res.mem_error) {
+            fprintf(log, "Memory integrity error after %d operations, replay with --seed %d\n", res.mem_error_op, res.seed);
+            ret = 1;
+        }
+    }
+    if(demo->create_cb == stress_widgets) stress_widgets_print(log);
+    if(demo->create_cb == stress_tree) stress_tree_print(log);
+#endif
+
+    uint32_t frame_cnt = lv_drv_headless_get_frame_cnt();
+    stat->frame_cnt = frame_cnt;
+    stat->cpu_ms = (uint32_t)(cpu_total / 1000000);
+    stat->frame_max_us = (uint32_t)(frame_cpu_max / 1000);
+    if(frame_cnt) stat->frame_avg_us = (uint32_t)(frame_cpu_sum / frame_cnt / 1000);
+    if(frame_times_cnt) {
+        qsort(frame_times, frame_times_cnt, sizeof(uint32_t), frame_time_cmp);
+        stat->frame_p99_us = frame_times[((uint64_t)frame_times_cnt * 99) / 100];
+    }
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    stat->heap_peak = mon.max_used;
+#endif
+#if LV_USE_DEMO_STRESS && LV_MEM_CUSTOM == 0
+    /*The free block histogram after the last cycle allocates nearly the whole heap, use the peak before it*/
+    if(demo->create_cb == lv_demo_stress && LV_DEMO_STRESS_CYCLES) {
+        lv_demo_stress_result_t stress_res;
+        lv_demo_stress_get_result(&stress_res);
+        if(stress_res.heap_peak) stat->heap_peak = stress_res.heap_peak;
+    }
+#endif
+
+    fprintf(log, "%s: %d frames in %d %s ms, CPU time: %d ms\n", demo->name, frame_cnt, lv_tick_elaps(start),
+            opt.virtual_step ? "virtual" : "real", stat->cpu_ms);
+    if(frame_cnt) {
+        fprintf(log, "CPU time per frame: avg. %d us, p99 %d us, max. %d us\n",
+                stat->frame_avg_us, stat->frame_p99_us, stat->frame_max_us);
+    }
+
+    if(opt.bus.kbit_per_sec && frame_cnt) {
+        lv_drv_headless_bus_stat_t bus_stat;
+        lv_drv_headless_get_bus_stat(&bus_stat);
+        uint32_t render_us = (uint32_t)(frame_cpu_sum / frame_cnt / 1000);
+        uint32_t stall_us = (uint32_t)(bus_stat.stall_ns / frame_cnt / 1000);
+        fprintf(log, "Bus per frame (modelled): %d transactions, %d bytes, transfer %d us, render waited %d us\n",
+                bus_stat.flush_cnt / frame_cnt, (uint32_t)(bus_stat.byte_cnt / frame_cnt),
+                (uint32_t)(bus_stat.bus_ns / frame_cnt / 1000), stall_us);
+        fprintf(log, "Frame time: render %d us (measured) + bus wait %d us (modelled) = %d us\n",
+                render_us, stall_us, render_us + stall_us);
+    }
+
+    if(scene_bus) {
+        scene_bus_update(true);
+        scene_bus_print(log);
+        free(scene_bus);
+        scene_bus = NULL;
+    }
+
+#if LV_DEMO_USE_IMG_COMPR
+    lv_demo_img_compr_stat_t compr;
+    lv_demo_img_compr_get_stat(&compr);
+    uint32_t open_cnt = compr.hit_cnt + compr.miss_cnt;
+    if(open_cnt) {
+        fprintf(log, "Compressed images: %d opened, cache hit %d%%, %d decoded in %d us (max. %d us), "
+                "cache %d/%d bytes (max. %d), %d evicted\n",
+                open_cnt, (compr.hit_cnt * 100) / open_cnt, compr.miss_cnt, compr.decode_time, compr.decode_time_max,
+                compr.cache_size, compr.cache_size_limit, compr.cache_size_max, compr.evict_cnt);
+    }
+#endif
+
+    return ret;
+}
+
+/**
+ * Split the benchmark's scenes between worker processes, run them parallel and print the merged results.
+ * @param demo      the benchmark demo
+ * @param jobs      number of workers
+ * @return          exit code
+ */
+static int run_parallel(const demo_dsc_t * demo, uint32_t jobs)
+{
+#if LV_USE_DEMO_BENCHMARK
+    uint32_t cnt = lv_demo_benchmark_get_scene_cnt();
+    if(jobs > cnt) jobs = cnt;
+
+    pid_t pids[JOBS_MAX];
+    int fds[JOBS_MAX];
+    uint32_t i;
+    for(i = 0; i < jobs; i++) {
+        int p[2];
+        if(pipe(p) != 0) return 1;
+
+        /*Flush to not print the buffered output in the children too*/
+        fflush(stdout);
+        pids[i] = fork();
+        if(pids[i] < 0) return 1;
+
+        if(pids[i] == 0) {
+            close(p[0]);
+            pin_to_cpu(i);
+            lv_demo_benchmark_set_scene_range((cnt * i) / jobs, (cnt * (i + 1)) / jobs);
+            run_stat_t stat;
+            int ret = run(demo, p[1], stderr, &stat);
+            close(p[1]);
+            exit(ret);
+        }
+
+        close(p[1]);
+        fds[i] = p[0];
+    }
+
+    lv_demo_benchmark_result_t * res = calloc(cnt, sizeof(lv_demo_benchmark_result_t));
+    if(res == NULL) return 1;
+
+    /*The results are small, they fit into the pipes so the workers don't block*/
+    int ret = 0;
+    for(i = 0; i < jobs; i++) {
+        worker_result_t wr;
+        while(read(fds[i], &wr, sizeof(wr)) == sizeof(wr)) {
+            if(wr.id < cnt) res[wr.id] = wr.res;
+        }
+        close(fds[i]);
+
+        int status;
+        waitpid(pids[i], &status, 0);
+        if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            fprintf(stderr, "Worker %d failed\n", i);
+            ret = 1;
+        }
+    }
+
+    benchmark_print(stdout, res, cnt);
+    free(res);
+
+    return ret;
+#else
+    LV_UNUSED(demo);
+    LV_UNUSED(jobs);
+    return 1;
+#endif
+}
+
+/**
+ * Run all the demos one after the other, each in a new process to start from a clean LVGL,
+ * and print a report about them
+ * @return          exit code
+ */
+static int run_all(void)
+{
+    printf("%-16s %10s %8s %10s %10s %10s %10s %8s\n", "demo", "startup", "frames", "avg", "p99", "max", "CPU", "heap");
+    printf("%-16s %10s %8s %10s %10s %10s %10s %8s\n", "", "[us]", "", "[us]", "[us]", "[us]", "[ms]", "[kB]");
+    fflush(stdout);
+
+    int ret = 0;
+    uint32_t i;
+    for(i = 0; demos[i].name; i++) {
+        int p[2];
+        if(pipe(p) != 0) return 1;
+
+        pid_t pid = fork();
+        if(pid < 0) return 1;
+
+        if(pid == 0) {
+            close(p[0]);
+            /*Print the details (e.g. the benchmark's results) to stderr to keep the report clean*/
+            run_stat_t stat;
+            int child_ret = run(&demos[i], -1, stderr, &stat);
+            if(write(p[1], &stat, sizeof(stat)) != sizeof(stat)) child_ret = 1;
+            close(p[1]);
+            exit(child_ret);
+        }
+
+        close(p[1]);
+        run_stat_t stat;
+        bool ok = read(p[0], &stat, sizeof(stat)) == sizeof(stat);
+        close(p[0]);
+
+        int status;
+        waitpid(pid, &status, 0);
+        if(!ok || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+            printf("%-16s failed\n", demos[i].name);
+            ret = 1;
+            continue;
+        }
+
+        printf("%-16s %10d %8d %10d %10d %10d %10d %8d\n", demos[i].name, stat.startup_us, stat.frame_cnt,
+               stat.frame_avg_us, stat.frame_p99_us, stat.frame_max_us, stat.cpu_ms, stat.heap_peak / 1024);
+        fflush(stdout);
+    }
+
+    return ret;
+}
+
+/**
+ * Pin the calling process to the `idx`th allowed CPU (wraps around)
+ * @param idx       index of the worker
+ */
+static void pin_to_cpu(uint32_t idx)
+{
+    cpu_set_t allowed;
+    if(sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return;
+
+    int cpu_cnt = CPU_COUNT(&allowed);
+    if(cpu_cnt == 0) return;
+
+    int nth = idx % cpu_cnt;
+    int cpu;
+    for(cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if(!CPU_ISSET(cpu, &allowed)) continue;
+        if(nth == 0) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(cpu, &set);
+            sched_setaffinity(0, sizeof(set), &set);
+            return;
+        }
+        nth--;
+    }
+}
+
+/**
+ * Save the CPU time of a frame
+ * @param us    the CPU time [us]
+ * @return      false: out of memory (the frame is not counted in the percentiles)
+ */
+static bool frame_time_add(uint32_t us)
+{
+    if(frame_times_cnt == frame_times_size) {
+        uint32_t new_size = frame_times_size ? frame_times_size * 2 : 1024;
+        uint32_t * new_times = realloc(frame_times, new_size * sizeof(uint32_t));
+        if(new_times == NULL) return false;
+        frame_times = new_times;
+        frame_times_size = new_size;
+    }
+
+    frame_times[frame_times_cnt] = us;
+    frame_times_cnt++;
+    return true;
+}
+
+static int frame_time_cmp(const void * a, const void * b)
+{
+    uint32_t ta = *(const uint32_t *)a;
+    uint32_t tb = *(const uint32_t *)b;
+    return ta < tb ? -1 : (ta > tb ? 1 : 0);
+}
+
+static void demo_finished_cb(void)
+{
+    finished = true;
+}
+
+static void benchmark_print(FILE * f, const lv_demo_benchmark_result_t * res, uint32_t cnt)
+{
+    fprintf(f, "scene,weight,fps,fps_opa,refr_cnt,refr_cnt_opa,time_sum,time_sum_opa\n");
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(res[i].name == NULL) continue;   /*A failed worker's scene*/
+        fprintf(f, "\"%s\",%d,%d,%d,%d,%d,%d,%d\n", res[i].name, res[i].weight,
+                res[i].fps_normal, res[i].fps_opa,
+                res[i].refr_cnt_normal, res[i].refr_cnt_opa,
+                res[i].time_sum_normal, res[i].time_sum_opa);
+    }
+}
+
+/**
+ * Add the bus statistics since the previous call to the benchmark's scene which was running until now
+ * @param force     true: add them even if the scene hasn't changed, e.g. at the end of the run
+ */
+static void scene_bus_update(bool force)
+{
+#if LV_USE_DEMO_BENCHMARK
+    int32_t act = lv_demo_benchmark_get_scene_act();
+    if(!force && act == scene_bus_act) return;
+
+    lv_drv_headless_bus_stat_t now;
+    lv_drv_headless_get_bus_stat(&now);
+    uint32_t frame_cnt = lv_drv_headless_get_frame_cnt();
+
+    if(scene_bus_act >= 0 && (uint32_t)scene_bus_act < lv_demo_benchmark_get_scene_cnt()) {
+        scene_bus_t * sb = &scene_bus[scene_bus_act];
+        sb->bus.flush_cnt += now.flush_cnt - scene_bus_start.flush_cnt;
+        sb->bus.byte_cnt += now.byte_cnt - scene_bus_start.byte_cnt;
+        sb->bus.bus_ns += now.bus_ns - scene_bus_start.bus_ns;
+        sb->bus.stall_ns += now.stall_ns - scene_bus_start.stall_ns;
+        sb->frame_cnt += frame_cnt - scene_bus_frame_start;
+    }
+
+    scene_bus_start = now;
+    scene_bus_frame_start = frame_cnt;
+    scene_bus_act = act;
+#else
+    LV_UNUSED(force);
+#endif
+}
+
+/**
+ * Print the bus statistics per frame of the benchmark's scenes as CSV
+ * @param f     print here
+ */
+static void scene_bus_print(FILE * f)
+{
+#if LV_USE_DEMO_BENCHMARK
+    fprintf(f, "scene,frames,transactions,bytes,transfer_us,wait_us\n");
+
+    uint32_t i;
+    for(i = 0; i < lv_demo_benchmark_get_scene_cnt(); i++) {
+        const scene_bus_t * sb = &scene_bus[i];
+        if(sb->frame_cnt == 0) continue;    /*Not in the scene range of this worker*/
+
+        lv_demo_benchmark_result_t res;
+        lv_demo_benchmark_get_result(i, &res);
+        fprintf(f, "\"%s\",%d,%d,%d,%d,%d\n", res.name, sb->frame_cnt, sb->bus.flush_cnt / sb->frame_cnt,
+                (uint32_t)(sb->bus.byte_cnt / sb->frame_cnt), (uint32_t)(sb->bus.bus_ns / sb->frame_cnt / 1000),
+                (uint32_t)(sb->bus.stall_ns / sb->frame_cnt / 1000));
+    }
+#else
+    LV_UNUSED(f);
+#endif
+}
+
+/**
+ * Print the heap after every cycle of the stress test and the free block histogram after the last one as CSV
+ * and the result of the leak check
+ * @param f     print here
+ * @return      true: the check passed
+ */
+static bool stress_print(FILE * f)
+{
+#if LV_USE_DEMO_STRESS
+    fprintf(f, "cycle,free_size,free_biggest_size,used_cnt,frag_pct\n");
+
+    lv_demo_stress_cycle_t c;
+    uint32_t i;
+    for(i = 0; lv_demo_stress_get_cycle(i, &c); i++) {
+        fprintf(f, "%d,%d,%d,%d,%d\n", i, c.free_size, c.free_biggest_size, c.used_cnt, c.frag_pct);
+    }
+
+    lv_demo_stress_result_t res;
+    lv_demo_stress_get_result(&res);
+
+    /*The free block histogram: free_lt64 ... free_lt65536, free_ge65536*/
+    uint32_t b;
+    for(b = 0; b < LV_DEMO_STRESS_HIST_BINS - 1; b++) fprintf(f, "free_lt%d,", 64 << b);
+    fprintf(f, "free_ge%d,free_skip\n", 64 << (LV_DEMO_STRESS_HIST_BINS - 2));
+    for(b = 0; b < LV_DEMO_STRESS_HIST_BINS; b++) fprintf(f, "%d,", res.free_hist[b]);
+    fprintf(f, "%d\n", res.free_hist_skip);
+    fprintf(f, "Stress: %s, %d cycles, leak: %d bytes / 1000 cycles (limit: %d), %d bytes after the warm up%s\n",
+            res.passed ? "passed" : "FAILED", res.cycle_cnt, res.leak_rate, LV_DEMO_STRESS_LEAK_LIMIT,
+            res.leak_total, res.mem_error ? ", memory integrity error" : "");
+    return res.passed;
+#else
+    LV_UNUSED(f);
+    return true;
+#endif
+}
+
+/**
+ * Start the stress test's fuzz mode with the options of the command line
+ */
+static void stress_fuzz(void)
+{
+#if LV_USE_DEMO_STRESS
+    lv_demo_stress_fuzz(opt.seed, opt.fuzz_ops);
+#endif
+}
+
+/**
+ * Start the stress test's widget mode with the options of the command line
+ */
+static void stress_widgets(void)
+{
+#if LV_USE_DEMO_STRESS
+    lv_demo_stress_widgets(opt.widget_cnt);
+#endif
+}
+
+/**
+ * Print the results of the stress test's widget mode as CSV
+ * @param f     print here
+ */
+static void stress_widgets_print(FILE * f)
+{
+#if LV_USE_DEMO_STRESS
+    fprintf(f, "widget,count,create_per_sec,create_us,delete_us,bytes,allocs\n");
+
+    lv_demo_stress_widget_result_t res;
+    uint32_t i;
+    for(i = 0; lv_demo_stress_widgets_get_result(i, &res); i++) {
+        fprintf(f, "%s,%d,%d,%.1f,%.1f,%d,%d\n", res.name, res.cnt, res.create_per_sec,
+                (double)res.create_time / res.cnt, (double)res.del_time / res.cnt, res.size, res.alloc_cnt);
+    }
+#else
+    LV_UNUSED(f);
+#endif
+}
+
+/**
+ * Start the stress test's tree mode with the options of the command line
+ */
+static void stress_tree(void)
+{
+#if LV_USE_DEMO_STRESS
+    lv_demo_stress_tree(opt.tree_max);
+#endif
+}
+
+/**
+ * Print the results of the stress test's tree mode as CSV. The per object operations are in ns / object.
+ * @param f     print here
+ */
+static void stress_tree_print(FILE * f)
+{
+#if LV_USE_DEMO_STRESS
+    fprintf(f, "shape,objects,create_us,layout_us,get_child_ns,get_child_id_ns,invalidate_ns,bubble_ns,clean_us,delete_us,bytes\n");
+
+    lv_demo_stress_tree_result_t res;
+    uint32_t i;
+    for(i = 0; lv_demo_stress_tree_get_result(i, &res); i++) {
+        const char * shape = res.deep ? "deep" : "wide";
+        if(res.skipped) {
+            fprintf(f, "%s,%d,skipped\n", shape, res.obj_cnt);
+            continue;
+        }
+
+        uint64_t n = res.sample_cnt;
+        fprintf(f, "%s,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d\n", shape, res.obj_cnt, res.create_time, res.layout_time,
+                (uint32_t)(res.get_child_time * 1000ULL / n), (uint32_t)(res.get_child_id_time * 1000ULL / n),
+                (uint32_t)(res.invalidate_time * 1000ULL / n), (uint32_t)(res.bubble_time * 1000ULL / n),
+                res.clean_time, res.del_time, res.obj_size);
+    }
+#else
+    LV_UNUSED(f);
+#endif
+}
+
+/**
+ * The clock of the demos' fine measurements. The CPU time to not count the time when an other process runs.
+ * @return      the CPU time [us]
+ */
+static uint32_t clock_us(void)
+{
+    return (uint32_t)(cpu_time_ns() / 1000);
+}
+
+static void sleep_ms(uint32_t ms)
+{
+    struct timespec ts;
+    ts.tv_sec = ms / 1000;
+    ts.tv_nsec = (long)(ms % 1000) * 1000000;
+    nanosleep(&ts, NULL);
+}
+
+static uint64_t real_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static uint64_t cpu_time_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void print_usage(const char * prog)
+{
+    fprintf(stderr, "Usage: %s [--demo NAME] [--time MS] [--res WxH] [--buf-lines N] [--virtual-tick MS]\n", prog);
+    fprintf(stderr, "       [--bus-kbps N] [--bus-overhead-us N] [--bus-bpp N] [--bus-dma] [--jobs N]\n");
+    fprintf(stderr, "       [--golden-write FILE | --golden-check FILE] [--golden-tol N]%s\n",
+            LV_DEMO_USE_PACK ? " [--pack FILE]" : "");
+    fprintf(stderr, "       [--seed N] [--fuzz-ops N] [--widget-cnt N] [--tree-max N]\n");
+    fprintf(stderr, "Demos: all");
+    uint32_t i;
+    for(i = 0; demos[i].name; i++) {
+        fprintf(stderr, " %s", demos[i].name);
+    }
+    fprintf(stderr, "\n");
+}
@@ -0,0 +1,275 @@
+/**
+ * @file runner_golden.c
+ * Render the benchmark's scenes at fixed virtual times and compare the frame buffer's checksums
+ * with a golden file. Used to verify that optimizations of the drawing don't change the output.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "runner_golden.h"
+#include "../lv_demo.h"
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#if LV_USE_DEMO_BENCHMARK
+
+/*********************
+ *      DEFINES
+ *********************/
+#define STEP_TIME       5       /*Advance the virtual time with this steps [ms]*/
+#define HASH_SIZE       8       /*The perceptual hash is made of HASH_SIZE x HASH_SIZE blocks*/
+#define GOLDEN_MAX      512
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t id;
+    uint32_t opa;
+    uint32_t time;
+    uint32_t crc;
+    uint64_t hash;
+} golden_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t fb_crc32(void);
+static uint64_t fb_ahash(void);
+static uint32_t px_rgb(const lv_color_t * px);
+static uint32_t bit_diff(uint64_t a, uint64_t b);
+static uint32_t golden_load(const char * path, golden_t * golden, const char * header);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*Check the scenes at the beginning and when the animations are running*/
+static const uint32_t snap_times[] = {100, 1000};
+
+static golden_t golden[GOLDEN_MAX];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int runner_golden_run(const char * path, bool write, uint32_t tol)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    char header[128];
+    lv_snprintf(header, sizeof(header), "# lv_demo golden v1 %dx%d %dbpp\n",
+                lv_disp_get_hor_res(disp), lv_disp_get_ver_res(disp), LV_COLOR_DEPTH);
+
+    FILE * f = NULL;
+    uint32_t golden_cnt = 0;
+    if(write) {
+        f = fopen(path, "w");
+        if(f == NULL) {
+            fprintf(stderr, "Couldn't open %s\n", path);
+            return 1;
+        }
+        fputs(header, f);
+    } else {
+        golden_cnt = golden_load(path, golden, header);
+        if(golden_cnt == 0) return 1;
+    }
+
+    uint32_t fail_cnt = 0;
+    uint32_t close_cnt = 0;
+    uint32_t cnt = lv_demo_benchmark_get_scene_cnt();
+    uint32_t id;
+    for(id = 0; id < cnt; id++) {
+        uint32_t opa;
+        for(opa = 0; opa < 2; opa++) {
+            lv_demo_benchmark_load_scene(id, opa);
+
+            /*Step the time always the same way to get the same animation states*/
+            uint32_t t = 0;
+            uint32_t s;
+            for(s = 0; s < sizeof(snap_times) / sizeof(snap_times[0]); s++) {
+                while(t < snap_times[s]) {
+                    lv_drv_headless_tick_inc(STEP_TIME);
+                    lv_timer_handler();
+                    t += STEP_TIME;
+                }
+
+                /*Render the whole screen to not depend on the previous scene*/
+                lv_obj_invalidate(lv_scr_act());
+                lv_refr_now(disp);
+
+                lv_demo_benchmark_result_t res;
+                lv_demo_benchmark_get_result(id, &res);
+                uint32_t crc = fb_crc32();
+                uint64_t hash = fb_ahash();
+
+                if(write) {
+                    fprintf(f, "%d %d %d %08" PRIx32 " %016" PRIx64 " %s\n", id, opa, t, crc, hash, res.name);
+                    continue;
+                }
+
+                uint32_t i;
+                for(i = 0; i < golden_cnt; i++) {
+                    if(golden[i].id == id && golden[i].opa == opa && golden[i].time == t) break;
+                }
+
+                if(i == golden_cnt) {
+                    printf("MISSING %s%s at %d ms\n", res.name, opa ? " + opa" : "", t);
+                    fail_cnt++;
+                } else if(golden[i].crc != crc) {
+                    uint32_t diff = bit_diff(golden[i].hash, hash);
+                    if(diff <= tol) {
+                        printf("CLOSE   %s%s at %d ms: %d bits of the hash differ\n", res.name, opa ? " + opa" : "", t, diff);
+                        close_cnt++;
+                    } else {
+                        printf("FAIL    %s%s at %d ms: %d bits of the hash differ\n", res.name, opa ? " + opa" : "", t, diff);
+                        fail_cnt++;
+                    }
+                }
+            }
+        }
+    }
+
+    if(write) {
+        fclose(f);
+        printf("Golden checksums written to %s\n", path);
+        return 0;
+    }
+
+    printf("Golden check: %d failed, %d close, %d identical\n", fail_cnt, close_cnt,
+           cnt * 2 * (uint32_t)(sizeof(snap_times) / sizeof(snap_times[0])) - fail_cnt - close_cnt);
+
+    return fail_cnt ? 1 : 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t fb_crc32(void)
+{
+    static uint32_t table[256];
+    if(table[1] == 0) {
+        uint32_t i;
+        for(i = 0; i < 256; i++) {
+            uint32_t c = i;
+            uint32_t k;
+            for(k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            table[i] = c;
+        }
+    }
+
+    lv_disp_t * disp = lv_disp_get_default();
+    uint32_t px_cnt = (uint32_t)disp->driver->hor_res * disp->driver->ver_res;
+    const lv_color_t * fb = lv_drv_headless_get_fb();
+
+    /*Use only the RGB channels as the alpha byte of the 32 bit colors is not always set*/
+    uint32_t crc = 0xFFFFFFFF;
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        uint32_t rgb = px_rgb(&fb[i]);
+        crc = table[(crc ^ rgb) & 0xFF] ^ (crc >> 8);
+        crc = table[(crc ^ (rgb >> 8)) & 0xFF] ^ (crc >> 8);
+        crc = table[(crc ^ (rgb >> 16)) & 0xFF] ^ (crc >> 8);
+    }
+
+    return crc ^ 0xFFFFFFFF;
+}
+
+/**
+ * Average hash: a bit is set if the block's brightness is above the average.
+ * Small differences (e.g. rounding in a blend function) change only a few bits.
+ */
+static uint64_t fb_ahash(void)
+{
+    lv_disp_t * disp = lv_disp_get_default();
+    lv_coord_t w = disp->driver->hor_res;
+    lv_coord_t h = disp->driver->ver_res;
+    const lv_color_t * fb = lv_drv_headless_get_fb();
+
+    uint64_t block_sum[HASH_SIZE * HASH_SIZE] = {0};
+    lv_coord_t y;
+    for(y = 0; y < h; y++) {
+        lv_coord_t x;
+        for(x = 0; x < w; x++) {
+            uint32_t rgb = px_rgb(&fb[(int32_t)y * w + x]);
+            uint32_t luma = (((rgb >> 16) & 0xFF) * 299 + ((rgb >> 8) & 0xFF) * 587 + (rgb & 0xFF) * 114) / 1000;
+            block_sum[((int32_t)y * HASH_SIZE / h) * HASH_SIZE + (int32_t)x * HASH_SIZE / w] += luma;
+        }
+    }
+
+    uint64_t total = 0;
+    uint32_t i;
+    for(i = 0; i < HASH_SIZE * HASH_SIZE; i++) total += block_sum[i];
+    uint64_t avg = total / (HASH_SIZE * HASH_SIZE);
+
+    uint64_t hash = 0;
+    for(i = 0; i < HASH_SIZE * HASH_SIZE; i++) {
+        if(block_sum[i] > avg) hash |= (uint64_t)1 << i;
+    }
+
+    return hash;
+}
+
+static uint32_t px_rgb(const lv_color_t * px)
+{
+    return lv_color_to32(*px) & 0xFFFFFF;
+}
+
+static uint32_t bit_diff(uint64_t a, uint64_t b)
+{
+    uint64_t x = a ^ b;
+    uint32_t cnt = 0;
+    while(x) {
+        x &= x - 1;
+        cnt++;
+    }
+    return cnt;
+}
+
+static uint32_t golden_load(const char * path, golden_t * dst, const char * header)
+{
+    FILE * f = fopen(path, "r");
+    if(f == NULL) {
+        fprintf(stderr, "Couldn't open %s\n", path);
+        return 0;
+    }
+
+    char line[256];
+    if(fgets(line, sizeof(line), f) == NULL || strcmp(line, header) != 0) {
+        fprintf(stderr, "%s was made with an other resolution or color depth. Expected: %s", path, header);
+        fclose(f);
+        return 0;
+    }
+
+    uint32_t cnt = 0;
+    while(cnt < GOLDEN_MAX && fgets(line, sizeof(line), f)) {
+        golden_t * g = &dst[cnt];
+        if(sscanf(line, "%" SCNu32 " %" SCNu32 " %" SCNu32 " %" SCNx32 " %" SCNx64,
+                  &g->id, &g->opa, &g->time, &g->crc, &g->hash) == 5) {
+            cnt++;
+        }
+    }
+
+    fclose(f);
+
+    if(cnt == 0) fprintf(stderr, "No checksums in %s\n", path);
+    return cnt;
+}
+
+#else
+
+int runner_golden_run(const char * path, bool write, uint32_t tol)
+{
+    LV_UNUSED(path);
+    LV_UNUSED(write);
+    LV_UNUSED(tol);
+    fprintf(stderr, "The golden check needs LV_USE_DEMO_BENCHMARK\n");
+    return 1;
+}
+
+#endif /*LV_USE_DEMO_BENCHMARK*/
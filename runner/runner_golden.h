@@ -0,0 +1,48 @@
+/**
+ * @file runner_golden.h
+ * Check the rendered image of the benchmark's scenes against stored checksums
+ */
+
+#ifndef RUNNER_GOLDEN_H
+#define RUNNER_GOLDEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_drv_headless.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Render every scene of the benchmark (normal and opa) at fixed times and write or check their checksums.
+ * LVGL and the headless display should be initialized and the virtual clock enabled.
+ * @param path      path of the golden file
+ * @param write     true: (re)write the golden file; false: compare with it
+ * @param tol       accepted number of different bits in the perceptual hash if the CRC differs
+ * @return          0: all scenes matched (or the file was written); 1: mismatch or error
+ */
+int runner_golden_run(const char * path, bool write, uint32_t tol);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*RUNNER_GOLDEN_H*/
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Make an asset pack of images for one color format (see src/assets/lv_demo_pack.h).
+The demos load it with `lv_demo_pack_open()` and use the pixels in place from the mapped file.
+
+Inputs:
+  image C files     e.g. img_lv_demo_music_cover_1.c, the asset's name is the name of its lv_img_dsc_t
+  PNG files         NAME=file.png, converted to the smallest lossless color format (see png_to_c.py)
+
+Usage:
+  asset_pack.py --depth 16 [--swap] -o music.pack img_a.c img_b.c img_c=c.png ...
+  asset_pack.py --list music.pack
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import img_c_to_bin     # noqa: E402
+import png_to_c         # noqa: E402
+
+MAGIC = 0x4B415044      # "DPAK"
+VERSION = 1
+ALIGN = 64
+NAME_MAX = 40
+TYPE_IMG = 1
+
+HEADER = struct.Struct('<IHHBBHI')
+ENTRY = struct.Struct('<%dsBBHHHII' % NAME_MAX)
+
+# lv_img_cf_t of LVGL v8
+CF = {
+    'TRUE_COLOR': 4, 'TRUE_COLOR_ALPHA': 5, 'TRUE_COLOR_CHROMA_KEYED': 6,
+    'INDEXED_1BIT': 7, 'INDEXED_2BIT': 8, 'INDEXED_4BIT': 9, 'INDEXED_8BIT': 10,
+    'ALPHA_1BIT': 11, 'ALPHA_2BIT': 12, 'ALPHA_4BIT': 13, 'ALPHA_8BIT': 14,
+}
+
+
+def load_c(path, depth, swap):
+    """Return (name, cf, w, h, data) of an image C file"""
+    with open(path) as f:
+        text = f.read()
+    _, _, _, data = img_c_to_bin.convert(text.splitlines(), depth, swap)
+
+    def field(pattern):
+        m = re.search(pattern, text)
+        if not m:
+            raise ValueError('%s: no match for %s' % (path, pattern))
+        return m.group(1)
+
+    name = field(r'lv_img_dsc_t\s+(\w+)\s*=')
+    cf = CF[field(r'\.header\.cf\s*=\s*LV_IMG_CF_(\w+)')]
+    w = int(field(r'\.header\.w\s*=\s*(\d+)'))
+    h = int(field(r'\.header\.h\s*=\s*(\d+)'))
+    return name, cf, w, h, data
+
+
+def load_png(name, path, depth, swap):
+    w, h, pixels = png_to_c.read_png(path)
+    sizes = [(len(png_to_c.encode(f, w, pixels, depth, swap)), f)
+             for f in png_to_c.lossless_formats(pixels, depth, swap)]
+    cf = min(sizes, key=lambda s: s[0])[1]
+    return name, CF[cf.upper()], w, h, png_to_c.encode(cf, w, pixels, depth, swap)
+
+
+def write_pack(path, assets, depth, swap):
+    assets = sorted(assets, key=lambda a: a[0].encode())    # The loader searches the index with strcmp()
+    names = [a[0] for a in assets]
+    for name in names:
+        if len(name.encode()) >= NAME_MAX:
+            raise ValueError('%s: the name is longer than %d characters' % (name, NAME_MAX - 1))
+        if names.count(name) > 1:
+            raise ValueError('%s is added more times' % name)
+
+    offset = HEADER.size + ENTRY.size * len(assets)
+    index = bytearray()
+    body = bytearray()
+    for name, cf, w, h, data in assets:
+        offset = (offset + ALIGN - 1) // ALIGN * ALIGN
+        pad = offset - (HEADER.size + ENTRY.size * len(assets) + len(body))
+        body += bytes(pad) + data
+        index += ENTRY.pack(name.encode(), TYPE_IMG, cf, w, h, 0, offset, len(data))
+        offset += len(data)
+
+    size = HEADER.size + len(index) + len(body)
+    with open(path, 'wb') as f:
+        f.write(HEADER.pack(MAGIC, VERSION, len(assets), depth, 1 if swap else 0, 0, size))
+        f.write(index)
+        f.write(body)
+    return size
+
+
+def list_pack(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    magic, version, cnt, depth, swap, _, size = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        raise ValueError('%s is not an asset pack' % path)
+    print('%s: version %d, %d bit%s, %d assets, %d bytes' % (path, version, depth, ' swapped' if swap else '', cnt, size))
+    cf_names = {v: k for k, v in CF.items()}
+    for i in range(cnt):
+        name, _, cf, w, h, _, offset, length = ENTRY.unpack_from(data, HEADER.size + i * ENTRY.size)
+        print('  %-40s %-24s %4dx%-4d %10d bytes at %d' % (name.rstrip(b'\0').decode(), cf_names.get(cf, cf), w, h, length, offset))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--depth', type=int, choices=(1, 8, 16, 32))
+    parser.add_argument('--swap', action='store_true', help='LV_COLOR_16_SWAP')
+    parser.add_argument('-o', '--output')
+    parser.add_argument('--list', metavar='PACK', help='show the content of a pack')
+    parser.add_argument('inputs', nargs='*')
+    args = parser.parse_args()
+
+    if args.list:
+        list_pack(args.list)
+        return 0
+
+    if not args.output or not args.depth or not args.inputs:
+        parser.error('--depth, --output and the inputs are required')
+
+    assets = []
+    for inp in args.inputs:
+        if '=' in inp:
+            name, path = inp.split('=', 1)
+            assets.append(load_png(name, path, args.depth, args.swap))
+        else:
+            assets.append(load_c(inp, args.depth, args.swap))
+
+    size = write_pack(args.output, assets, args.depth, args.swap)
+    print('%s: %d assets, %d bytes' % (args.output, len(assets), size))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
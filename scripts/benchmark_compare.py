@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+"""
+Compare two benchmark results printed by the headless runner (lv_demo_runner --demo benchmark)
+and show the gain per scene.
+
+Usage: benchmark_compare.py ref.csv new.csv
+"""
+import csv
+import sys
+
+
+def load(path):
+    """Read the CSV rows of the runner's output, other lines (statistics) are skipped"""
+    with open(path) as f:
+        lines = [l for l in f if l.startswith('scene,') or l.startswith('"')]
+    res = {}
+    for row in csv.DictReader(lines):
+        refr_cnt = int(row['refr_cnt']) + int(row['refr_cnt_opa'])
+        time_sum = int(row['time_sum']) + int(row['time_sum_opa'])
+        if refr_cnt == 0:
+            continue
+        # Average render time of a frame. More precise than FPS for the fast scenes.
+        res[row['scene']] = (time_sum / refr_cnt, int(row['weight']))
+    return res
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__)
+        return 1
+
+    ref = load(sys.argv[1])
+    new = load(sys.argv[2])
+
+    print('%-40s %10s %10s %8s' % ('Scene', 'ref [ms]', 'new [ms]', 'gain'))
+    w_sum = 0
+    w_gain_sum = 0
+    for name, (ref_ms, weight) in ref.items():
+        if name not in new:
+            continue
+        new_ms = new[name][0]
+        gain = (ref_ms / new_ms - 1) * 100 if new_ms else 0
+        w_sum += weight
+        w_gain_sum += gain * weight
+        print('%-40s %10.2f %10.2f %+7.1f%%' % (name, ref_ms, new_ms, gain))
+
+    if w_sum:
+        print('%-40s %10s %10s %+7.1f%%' % ('Weighted', '', '', w_gain_sum / w_sum))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
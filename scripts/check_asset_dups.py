@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+Check that the fonts and images of the demos are not duplicated.
+
+An asset used by more demos should be defined only once in src/assets.
+Two kinds of duplicates are reported:
+  - the same data in more files (e.g. a copied font with a renamed symbol)
+  - the same exported symbol defined in more files with the same `#if` guard (would collide when linking)
+
+The data is compared by the sequence of numeric literals of the file, so the symbol names,
+comments, preprocessor lines and formatting don't matter.
+Variants selected by exclusive guards (e.g. the `_large` images of the music demo) are fine.
+
+Usage: check_asset_dups.py [src_dir]
+Returns 1 if there are duplicates.
+"""
+import hashlib
+import os
+import re
+import sys
+
+NUMBER = re.compile(r'\b(?:0x[0-9a-fA-F]+|\d+)\b')
+COMMENT = re.compile(r'/\*.*?\*/|//[^\n]*', re.DOTALL)
+PREPROCESSOR = re.compile(r'^\s*#.*$', re.MULTILINE)
+GUARD = re.compile(r'^\s*#\s*if\s+(.*)$', re.MULTILINE)
+# `const lv_font_t name = {`, `const lv_img_dsc_t name = {`
+EXPORTED = re.compile(r'^\s*(?:const\s+)?(?:lv_font_t|lv_img_dsc_t)\s+(\w+)\s*=', re.MULTILINE)
+
+
+def asset_files(src_dir):
+    for root, _, files in os.walk(src_dir):
+        if os.path.basename(root) != 'assets':
+            continue
+        for name in sorted(files):
+            if name.endswith('.c'):
+                yield os.path.join(root, name)
+
+
+def data_hash(text):
+    """Hash of the numeric literals (the pixel and glyph data) without the comments and preprocessor lines"""
+    numbers = NUMBER.findall(PREPROCESSOR.sub('', COMMENT.sub('', text)))
+    return hashlib.sha1(' '.join(n.lower() for n in numbers).encode()).hexdigest(), len(numbers)
+
+
+def guard(text):
+    """The first `#if` condition of the file without whitespaces, e.g. `LV_USE_DEMO_MUSIC&&LV_DEMO_MUSIC_LARGE`"""
+    m = GUARD.search(COMMENT.sub('', text))
+    return re.sub(r'\s+', '', m.group(1)) if m else ''
+
+
+def main():
+    src_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), '..', 'src')
+
+    by_hash = {}    # hash -> [files]
+    by_symbol = {}  # (symbol, guard) -> [files]
+    file_cnt = 0
+    for path in asset_files(src_dir):
+        with open(path, errors='replace') as f:
+            text = f.read()
+        file_cnt += 1
+        digest, cnt = data_hash(text)
+        if cnt:
+            by_hash.setdefault(digest, []).append(path)
+        for sym in EXPORTED.findall(text):
+            by_symbol.setdefault((sym, guard(text)), []).append(path)
+
+    dup_cnt = 0
+    for files in by_hash.values():
+        if len(files) > 1:
+            print('Same data in: %s' % ', '.join(os.path.relpath(p, src_dir) for p in files))
+            dup_cnt += 1
+    for (sym, _), files in sorted(by_symbol.items()):
+        if len(files) > 1:
+            print('%s is defined in: %s' % (sym, ', '.join(os.path.relpath(p, src_dir) for p in files)))
+            dup_cnt += 1
+
+    if dup_cnt:
+        print('%d duplicated asset(s). Move the shared assets to src/assets.' % dup_cnt)
+        return 1
+
+    print('No duplicated assets in %d files' % file_cnt)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+"""
+Report the flash and RAM footprint of the demos per demo and per asset using `nm`,
+and optionally fail if the sizes are above the limits.
+
+Usage: footprint.py [--nm NM] [--limits FILE] [--write-limits FILE] [--margin PCT] [--assets N]
+                    [--xip [--objdump OBJDUMP]] lib1.a lib2.a ...
+
+The libraries are the per-demo targets (e.g. liblv_demo_music.a), the demo's name is taken from the file name.
+Sections:
+  text      code (nm type T, t)
+  rodata    constant data, e.g. the images and fonts (R, r)
+  data      initialized variables, they use both flash and RAM (D, d)
+  bss       zero initialized variables (B, b, C)
+
+With --xip the build fails if an asset (image or font object) is in a section which is copied
+from flash to RAM at startup (.data, .sdata). Such assets can't be used in place from the flash.
+`.data.rel.ro` is fine: it's read-only and it's only used by position independent (host) builds.
+
+Limits file: one limit per line, `#` starts a comment
+  <demo> <section> <max. bytes>          e.g. `music rodata 2500000`
+  <demo>:<symbol> <section> <max. bytes>  e.g. `music:img_lv_demo_music_cover_1 rodata 70000`
+An asset limit fails if the symbol is not found in its section of a checked demo,
+so rewrite the limits with --write-limits after renaming or removing an asset.
+"""
+import argparse
+import math
+import os
+import re
+import subprocess
+import sys
+
+SECTIONS = ('text', 'rodata', 'data', 'bss')
+TYPE_TO_SECTION = {
+    't': 'text', 'r': 'rodata', 'd': 'data', 'b': 'bss', 'c': 'bss',
+    'g': 'data', 's': 'bss', 'v': 'data', 'w': 'text',
+}
+
+
+def demo_name(lib):
+    """liblv_demo_music.a -> music"""
+    name = os.path.basename(lib)
+    name = re.sub(r'^(lib)?(lv_demo_)?', '', name)
+    return re.sub(r'\.(a|o|elf|so)$', '', name)
+
+
+def read_symbols(nm, lib):
+    """Yield (object file, symbol, section, size) of the defined symbols"""
+    out = subprocess.run([nm, '--print-size', '--size-sort', '--radix=d', lib],
+                         check=True, capture_output=True, text=True).stdout
+    obj = os.path.basename(lib)
+    for line in out.splitlines():
+        if line.endswith(':'):
+            obj = line[:-1]
+            continue
+        parts = line.split()
+        if len(parts) != 4:
+            continue
+        size, sym_type, name = int(parts[1]), parts[2].lower(), parts[3]
+        section = TYPE_TO_SECTION.get(sym_type)
+        if section:
+            yield obj, name, section, size
+
+
+def read_sections(objdump, lib):
+    """Yield (object file, symbol, section name) of the defined data objects"""
+    out = subprocess.run([objdump, '-t', lib], check=True, capture_output=True, text=True).stdout
+    obj = os.path.basename(lib)
+    for line in out.splitlines():
+        m = re.match(r'^(\S+):\s+file format', line)
+        if m:
+            obj = m.group(1)
+            continue
+        m = re.match(r'^[0-9a-fA-F]+ (.{7}) (\S+)\s+[0-9a-fA-F]+\s+(\S+)$', line)
+        if m and 'O' in m.group(1):
+            yield obj, m.group(3), m.group(2)
+
+
+def copied_to_ram(section):
+    return section.startswith(('.data', '.sdata')) and not section.startswith('.data.rel.ro')
+
+
+def is_asset(obj):
+    return obj.startswith('img_') or obj.startswith('lv_font_')
+
+
+def load_limits(path):
+    limits = []
+    with open(path) as f:
+        for line in f:
+            line = line.split('#')[0].strip()
+            if not line:
+                continue
+            key, section, limit = line.split()
+            if section not in SECTIONS:
+                raise ValueError('Unknown section "%s" in %s' % (section, path))
+            limits.append((key, section, int(limit)))
+    return limits
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('libs', nargs='+')
+    parser.add_argument('--nm', default='nm')
+    parser.add_argument('--limits', help='fail if a size is above its limit')
+    parser.add_argument('--write-limits', help='save the current sizes + margin as limits')
+    parser.add_argument('--margin', type=float, default=5, help='margin of --write-limits [%%]')
+    parser.add_argument('--assets', type=int, default=10, help='show the N largest assets per demo')
+    parser.add_argument('--xip', action='store_true', help='fail if an asset is copied to RAM at startup')
+    parser.add_argument('--objdump', default='objdump')
+    args = parser.parse_args()
+
+    totals = {}     # demo -> section -> bytes
+    assets = {}     # demo:symbol -> (section, bytes)
+    for lib in args.libs:
+        demo = demo_name(lib)
+        totals[demo] = dict.fromkeys(SECTIONS, 0)
+        for obj, sym, section, size in read_symbols(args.nm, lib):
+            totals[demo][section] += size
+            if is_asset(obj):
+                assets['%s:%s' % (demo, sym)] = (section, size)
+
+    print('%-20s %10s %10s %10s %10s %10s %10s' % ('demo', 'text', 'rodata', 'data', 'bss', 'flash', 'RAM'))
+    for demo, t in totals.items():
+        flash = t['text'] + t['rodata'] + t['data']
+        ram = t['data'] + t['bss']
+        print('%-20s %10d %10d %10d %10d %10d %10d' % (demo, t['text'], t['rodata'], t['data'], t['bss'], flash, ram))
+
+    for demo in totals:
+        demo_assets = sorted(((k, v) for k, v in assets.items() if k.startswith(demo + ':')),
+                             key=lambda kv: kv[1][1], reverse=True)
+        if not demo_assets:
+            continue
+        print('\nLargest assets of %s:' % demo)
+        for key, (section, size) in demo_assets[:args.assets]:
+            print('  %-50s %-7s %10d' % (key.split(':', 1)[1], section, size))
+
+    if args.write_limits:
+        with open(args.write_limits, 'w') as f:
+            f.write('# Generated by footprint.py with %g%% margin\n' % args.margin)
+            for demo, t in totals.items():
+                for section in SECTIONS:
+                    if t[section]:
+                        f.write('%s %s %d\n' % (demo, section, math.ceil(t[section] * (100 + args.margin) / 100)))
+            for key, (section, size) in sorted(assets.items()):
+                f.write('%s %s %d\n' % (key, section, math.ceil(size * (100 + args.margin) / 100)))
+
+    if args.xip:
+        ram_assets = []
+        for lib in args.libs:
+            for obj, sym, section in read_sections(args.objdump, lib):
+                if is_asset(obj) and copied_to_ram(section):
+                    ram_assets.append((demo_name(lib), sym, section))
+        if ram_assets:
+            for demo, sym, section in ram_assets:
+                print('FAIL: %s:%s is in %s, it\'s copied to RAM at startup' % (demo, sym, section))
+            return 1
+        print('\nNo asset is copied to RAM at startup')
+
+    if args.limits:
+        fail = False
+        for key, section, limit in load_limits(args.limits):
+            if ':' in key:
+                # A stale limit would pass with 0 bytes and hide the growth of the renamed asset
+                if key.split(':', 1)[0] in totals and assets.get(key, (None,))[0] != section:
+                    print('FAIL: %s %s matches no asset, it was renamed, moved or removed, update %s'
+                          % (key, section, args.limits))
+                    fail = True
+                    continue
+                size = assets[key][1] if key in assets else 0
+            else:
+                size = totals.get(key, {}).get(section, 0)
+            if size > limit:
+                print('FAIL: %s %s is %d bytes, the limit is %d' % (key, section, size, limit))
+                fail = True
+        if fail:
+            return 1
+        print('\nAll sizes are within the limits of %s' % args.limits)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
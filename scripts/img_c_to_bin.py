@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""
+Convert an image C file of the demos (e.g. img_lv_demo_music_cover_1.c) to a raw binary file
+with the pixel data of one color format and a small C file which embeds the binary file.
+
+The giant hex arrays have a branch for every color depth. Only the selected branch is kept,
+so the compiler needs to read only a few lines instead of megabytes of text.
+The generated C file defines the same `lv_img_dsc_t` and `..._map` symbols as the original.
+It uses C23 `#embed` if the compiler supports it, else the `.incbin` assembler directive on ELF targets
+(GCC, Clang). Elsewhere (e.g. Mach-O, COFF) it includes the bytes as a plain C array from output.inc
+(next to output.bin), which is still only one color format.
+`#embed` and the C array keep the attributes of the original array (e.g. LV_ATTRIBUTE_LARGE_CONST).
+`.incbin` can't have them, so define LV_DEMO_EMBED_NO_INCBIN if they place the images in a special section.
+
+Usage: img_c_to_bin.py --depth 16 [--swap] input.c output.c output.bin
+"""
+import argparse
+import os
+import re
+import sys
+
+MAP_START = re.compile(r'^\s*(?:const\s+)?(?:LV_ATTRIBUTE_\w+\s+)*(?:const\s+)?uint8_t\s+(\w+)\s*\[\s*\]\s*=\s*\{')
+INCLUDE = re.compile(r'^\s*#\s*include\s+"([^"]+)"')
+
+
+def eval_cond(cond, depth, swap):
+    """Evaluate an `#if` condition of the color formats, e.g. `LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0`"""
+    cond = cond.split('/*')[0].split('//')[0]
+    cond = cond.replace('LV_COLOR_DEPTH', str(depth)).replace('LV_COLOR_16_SWAP', '1' if swap else '0')
+    cond = cond.replace('&&', ' and ').replace('||', ' or ')
+    cond = re.sub(r'!(?!=)', ' not ', cond)
+    if not re.fullmatch(r'[\d\s()=!<>a-z]*', cond):
+        raise ValueError('Unknown condition: ' + cond)
+    return bool(eval(cond))
+
+
+def convert(lines, depth, swap):
+    """Return (name of the map array, index of its first and last line, the bytes of the selected color format)"""
+    start = None
+    for i, line in enumerate(lines):
+        m = MAP_START.match(line)
+        if m:
+            name, start = m.group(1), i
+            break
+    if start is None:
+        raise ValueError('No uint8_t map array')
+
+    data = bytearray()
+    active = [True]     # Stack of the #if states
+    taken = [True]      # Stack of "a branch was already taken"
+    for end in range(start + 1, len(lines)):
+        line = lines[end].strip()
+        if line.startswith('#'):
+            directive = line[1:].strip()
+            if directive.startswith('if'):
+                cond = eval_cond(directive[2:], depth, swap) if directive.startswith('if ') else True
+                active.append(active[-1] and cond)
+                taken.append(cond)
+            elif directive.startswith('elif'):
+                cond = not taken[-1] and eval_cond(directive[4:], depth, swap)
+                active[-1] = active[-2] and cond
+                taken[-1] = taken[-1] or cond
+            elif directive.startswith('else'):
+                active[-1] = active[-2] and not taken[-1]
+                taken[-1] = True
+            elif directive.startswith('endif'):
+                active.pop()
+                taken.pop()
+            continue
+
+        if line.startswith('};'):
+            return name, start, end, bytes(data)
+
+        if active[-1]:
+            line = re.sub(r'/\*.*?\*/', '', line).split('//')[0]
+            for tok in line.split(','):
+                tok = tok.strip()
+                if tok:
+                    data.append(int(tok, 0))
+
+    raise ValueError('The map array is not closed')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--depth', type=int, required=True, choices=(1, 8, 16, 32))
+    parser.add_argument('--swap', action='store_true', help='LV_COLOR_16_SWAP')
+    parser.add_argument('input')
+    parser.add_argument('output_c')
+    parser.add_argument('output_bin')
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        lines = f.read().splitlines()
+
+    name, start, end, data = convert(lines, args.depth, args.swap)
+
+    with open(args.output_bin, 'wb') as f:
+        f.write(data)
+
+    inc_path = os.path.splitext(args.output_bin)[0] + '.inc'
+    with open(inc_path, 'w') as f:
+        for i in range(0, len(data), 32):
+            f.write('  ' + ', '.join('0x%02x' % b for b in data[i:i + 32]) + ',\n')
+
+    # The generated file is in an other directory so use absolute paths in the includes
+    src_dir = os.path.dirname(os.path.abspath(args.input))
+    head = []
+    for line in lines[:start]:
+        m = INCLUDE.match(line)
+        if m:
+            line = '#include "%s"' % os.path.normpath(os.path.join(src_dir, m.group(1))).replace('\\', '/')
+        head.append(line)
+
+    bin_path = os.path.abspath(args.output_bin).replace('\\', '/')
+    inc_path = os.path.abspath(inc_path).replace('\\', '/')
+    # The original definition with its attributes, e.g. `const LV_ATTRIBUTE_MEM_ALIGN uint8_t name[] = {`
+    decl = lines[start][:lines[start].index('{') + 1].strip()
+    embed = '''/*Generated by img_c_to_bin.py from {src}. Don't edit.*/
+#if LV_COLOR_DEPTH != {depth} || (LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != {swap})
+#error "{base} was generated for an other color format. Generate it again."
+#endif
+
+#if defined(__has_embed)
+{decl}
+#embed "{bin}"
+}};
+#elif defined(__ELF__) && !defined(LV_DEMO_EMBED_NO_INCBIN)
+#ifndef LV_ATTRIBUTE_MEM_ALIGN_SIZE
+#define LV_ATTRIBUTE_MEM_ALIGN_SIZE 1
+#endif
+#define LV_DEMO_EMBED_STR_(x) #x
+#define LV_DEMO_EMBED_STR(x) LV_DEMO_EMBED_STR_(x)
+__asm__(
+    "  .section .rodata\\n"
+    "  .global {name}\\n"
+    "  .type {name}, %object\\n"
+    "  .balign " LV_DEMO_EMBED_STR(LV_ATTRIBUTE_MEM_ALIGN_SIZE) "\\n"
+    "{name}:\\n"
+    "  .incbin \\"{bin}\\"\\n"
+    "  .size {name}, {size}\\n"
+    "  .previous\\n");
+extern const uint8_t {name}[];
+#else
+{decl}
+#include "{inc}"
+}};
+#endif'''.format(src=os.path.basename(args.input), depth=args.depth, swap=1 if args.swap else 0,
+                 base=os.path.basename(args.output_c), name=name, bin=bin_path, inc=inc_path, size=len(data), decl=decl)
+
+    with open(args.output_c, 'w') as f:
+        f.write('\n'.join(head + [embed] + lines[end + 1:]) + '\n')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
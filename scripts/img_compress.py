@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+"""
+Compress an image C file of the demos for one color format (LV_COLOR_DEPTH and LV_COLOR_16_SWAP)
+to be decoded at runtime by src/assets/lv_demo_img_compr.c.
+
+The image gets the LV_IMG_CF_USER_ENCODED_0 color format and its data starts with
+an lv_demo_img_compr_header_t (method, color format of the decoded image, decoded size).
+Methods:
+  rle   runs of the same pixel: a control byte, bit 7 = 1: (bits 0..6) + 1 repeated pixels follow
+        as one pixel, bit 7 = 0: (bits 0..6) + 1 literal pixels follow. Good for flat images.
+  lz4   LZ4 block format. Good for everything else, decodes fast.
+Only the true color formats are supported (the decoded image is drawn directly).
+
+Usage: img_compress.py --depth 16 [--swap] --method lz4 input.c output.c
+"""
+import argparse
+import os
+import re
+import struct
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import img_c_to_bin     # noqa: E402
+
+METHODS = {'rle': 1, 'lz4': 2}
+CF = {'TRUE_COLOR': 4, 'TRUE_COLOR_ALPHA': 5, 'TRUE_COLOR_CHROMA_KEYED': 6}
+HEADER = struct.Struct('<BBHI')
+
+
+def px_size(cf, depth):
+    """Bytes of a pixel in the map. 1 bit images use 1 byte per pixel like 8 bit ones."""
+    color = 4 if depth == 32 else 2 if depth == 16 else 1
+    return color + 1 if cf == 'TRUE_COLOR_ALPHA' and depth != 32 else color
+
+
+def rle_encode(data, px):
+    out = bytearray()
+    pixels = [data[i:i + px] for i in range(0, len(data), px)]
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 128 and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            out.append(0x80 | (run - 1))
+            out += pixels[i]
+            i += run
+            continue
+        lit = 1
+        while i + lit < len(pixels) and lit < 128 and \
+                not (i + lit + 1 < len(pixels) and pixels[i + lit] == pixels[i + lit + 1]):
+            lit += 1
+        out.append(lit - 1)
+        for p in pixels[i:i + lit]:
+            out += p
+        i += lit
+    return bytes(out)
+
+
+def rle_decode(data, px):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        c = data[i]
+        i += 1
+        if c & 0x80:
+            out += data[i:i + px] * ((c & 0x7f) + 1)
+            i += px
+        else:
+            n = (c + 1) * px
+            out += data[i:i + n]
+            i += n
+    return bytes(out)
+
+
+def lz4_encode(data):
+    """Greedy LZ4 block compressor. The last 5 bytes are literals and no match starts in the last 12 bytes."""
+    out = bytearray()
+    table = {}
+    n = len(data)
+    anchor = 0
+    i = 0
+    match_limit = n - 12
+
+    def write_seq(lit_start, lit_end, offset, match_len):
+        lit_len = lit_end - lit_start
+        token_lit = min(lit_len, 15)
+        token_match = min(match_len - 4, 15) if match_len else 0
+        out.append(token_lit << 4 | token_match)
+        if lit_len >= 15:
+            rest = lit_len - 15
+            while rest >= 255:
+                out.append(255)
+                rest -= 255
+            out.append(rest)
+        out.extend(data[lit_start:lit_end])
+        if match_len:
+            out.extend(struct.pack('<H', offset))
+            if match_len - 4 >= 15:
+                rest = match_len - 4 - 15
+                while rest >= 255:
+                    out.append(255)
+                    rest -= 255
+                out.append(rest)
+
+    while i < match_limit:
+        key = data[i:i + 4]
+        cand = table.get(key)
+        table[key] = i
+        if cand is not None and i - cand <= 0xffff:
+            length = 4
+            while i + length < n - 5 and data[cand + length] == data[i + length]:
+                length += 1
+            write_seq(anchor, i, i - cand, length)
+            i += length
+            anchor = i
+        else:
+            i += 1
+
+    write_seq(anchor, n, 0, 0)
+    return bytes(out)
+
+
+def lz4_decode(data, size):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        token = data[i]
+        i += 1
+        lit = token >> 4
+        if lit == 15:
+            while True:
+                b = data[i]
+                i += 1
+                lit += b
+                if b != 255:
+                    break
+        out += data[i:i + lit]
+        i += lit
+        if i >= len(data):
+            break
+        offset = data[i] | data[i + 1] << 8
+        i += 2
+        match = (token & 15) + 4
+        if token & 15 == 15:
+            while True:
+                b = data[i]
+                i += 1
+                match += b
+                if b != 255:
+                    break
+        for _ in range(match):
+            out.append(out[-offset])
+    assert len(out) == size
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--depth', type=int, required=True, choices=(1, 8, 16, 32))
+    parser.add_argument('--swap', action='store_true', help='LV_COLOR_16_SWAP')
+    parser.add_argument('--method', choices=sorted(METHODS), default='lz4')
+    parser.add_argument('input')
+    parser.add_argument('output_c')
+    args = parser.parse_args()
+
+    with open(args.input) as f:
+        text = f.read()
+    lines = text.splitlines()
+    map_name, start, end, data = img_c_to_bin.convert(lines, args.depth, args.swap)
+
+    text_tail = '\n'.join(lines[end + 1:])
+    cf = re.search(r'\.header\.cf\s*=\s*LV_IMG_CF_(\w+)', text_tail).group(1)
+    if cf not in CF:
+        raise ValueError('%s: only the true color formats can be compressed, not %s' % (args.input, cf))
+
+    px = px_size(cf, args.depth)
+    if args.method == 'rle':
+        compr = rle_encode(data, px)
+        assert rle_decode(compr, px) == data
+    else:
+        compr = lz4_encode(data)
+        assert lz4_decode(compr, len(data)) == data
+
+    blob = HEADER.pack(METHODS[args.method], CF[cf], 0, len(data)) + compr
+
+    # Keep the includes and guards of the original file (e.g. `#if LV_USE_DEMO_MUSIC`), only the map
+    # and the descriptor's color format and size change
+    src_dir = os.path.dirname(os.path.abspath(args.input))
+    head = []
+    for line in lines[:start]:
+        m = img_c_to_bin.INCLUDE.match(line)
+        if m:
+            line = '#include "%s"' % os.path.normpath(os.path.join(src_dir, m.group(1))).replace('\\', '/')
+        head.append(line)
+
+    text_tail = re.sub(r'\.header\.cf\s*=\s*LV_IMG_CF_\w+', '.header.cf = LV_IMG_CF_USER_ENCODED_0', text_tail)
+    text_tail = re.sub(r'\.data_size\s*=\s*[^,]+', '.data_size = %d' % len(blob), text_tail)
+
+    body = ['  ' + ', '.join('0x%02x' % b for b in blob[i:i + 32]) + ',' for i in range(0, len(blob), 32)]
+    with open(args.output_c, 'w') as f:
+        f.write('/*Generated by img_compress.py from %s (%s, %d -> %d bytes). Don\'t edit.*/\n'
+                % (os.path.basename(args.input), args.method, len(data), len(blob)))
+        f.write('\n'.join(head) + '\n')
+        f.write('''#if LV_COLOR_DEPTH != {depth} || (LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != {swap})
+#error "{base} was generated for an other color format. Generate it again."
+#endif
+const LV_ATTRIBUTE_MEM_ALIGN uint8_t {map}[] = {{
+{data}
+}};
+'''.format(depth=args.depth, swap=1 if args.swap else 0, base=os.path.basename(args.output_c), map=map_name,
+           data='\n'.join(body)))
+        f.write(text_tail + '\n')
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,38 @@
+#!/bin/bash
+# Build the headless benchmark without and with profile guided optimization
+# and compare the results per scene. The benchmark itself is the training workload.
+#
+# Usage: LVGL_DIR=../lvgl LTO=ON JOBS=1 scripts/pgo_benchmark.sh [runner options]
+set -e
+LVGL_DIR=$(realpath ${LVGL_DIR:-../lvgl})
+LTO=${LTO:-OFF}
+JOBS=${JOBS:-1}
+BUILD=${BUILD:-build_pgo}
+CMAKE_ARGS="-DLV_DEMO_BUILD_RUNNER=ON -DLVGL_DIR=$LVGL_DIR -DCMAKE_BUILD_TYPE=Release -DLV_DEMO_LTO=$LTO"
+
+echo "-- Building the reference ..."
+cmake -S . -B $BUILD/ref $CMAKE_ARGS -DLV_DEMO_PGO=OFF > /dev/null
+cmake --build $BUILD/ref -j$(nproc) > /dev/null
+echo "-- Running the reference ..."
+$BUILD/ref/runner/lv_demo_runner --demo benchmark --jobs $JOBS "$@" > $BUILD/ref.csv
+
+echo "-- Building with instrumentation ..."
+rm -rf $BUILD/pgo/profile
+cmake -S . -B $BUILD/pgo $CMAKE_ARGS -DLV_DEMO_PGO=GENERATE -DLV_DEMO_PGO_DIR=$(pwd)/$BUILD/pgo/profile > /dev/null
+cmake --build $BUILD/pgo -j$(nproc) > /dev/null
+echo "-- Training ..."
+$BUILD/pgo/runner/lv_demo_runner --demo benchmark --jobs $(nproc) "$@" > /dev/null
+
+# Clang writes raw profiles which have to be merged
+if ls $BUILD/pgo/profile/*.profraw > /dev/null 2>&1; then
+  llvm-profdata merge -o $BUILD/pgo/profile/default.profdata $BUILD/pgo/profile/*.profraw
+fi
+
+echo "-- Building with the profile ..."
+# Use the same build directory so the profiles match the object files
+cmake -S . -B $BUILD/pgo $CMAKE_ARGS -DLV_DEMO_PGO=USE > /dev/null
+cmake --build $BUILD/pgo -j$(nproc) > /dev/null
+echo "-- Running with PGO ..."
+$BUILD/pgo/runner/lv_demo_runner --demo benchmark --jobs $JOBS "$@" > $BUILD/pgo.csv
+
+python3 scripts/benchmark_compare.py $BUILD/ref.csv $BUILD/pgo.csv
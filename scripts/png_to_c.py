@@ -0,0 +1,302 @@
+#!/usr/bin/env python3
+"""
+Convert a PNG file to an LVGL image C file for one color format (LV_COLOR_DEPTH and LV_COLOR_16_SWAP).
+
+The pre-generated C files of the demos contain the pixels for every color depth,
+this script writes only the configured one. With `--cf auto` the smallest color format is selected
+which shows the image without loss on the given color depth:
+  true_color               opaque images
+  true_color_chroma_keyed  only fully transparent or opaque pixels and LV_COLOR_CHROMA_KEY is not used
+  indexed_1/2/4/8bit       at most 2, 4, 16 or 256 different colors (after converting them to the color depth)
+  true_color_alpha         any image
+The alpha only formats are not selected automatically as they are drawn with the recolor of the style,
+but they can be forced with `--cf alpha_1/2/4/8bit`.
+
+No external packages are needed, only the non-interlaced PNGs are supported.
+
+Usage: png_to_c.py --depth 16 [--swap] [--cf auto] [--name img_x] input.png output.c
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+# Default LV_COLOR_CHROMA_KEY of lv_conf.h (pure green)
+CHROMA_KEY = (0x00, 0xff, 0x00)
+
+COLOR_FORMATS = ('auto', 'true_color', 'true_color_alpha', 'true_color_chroma_keyed',
+                 'indexed_1bit', 'indexed_2bit', 'indexed_4bit', 'indexed_8bit',
+                 'alpha_1bit', 'alpha_2bit', 'alpha_4bit', 'alpha_8bit')
+
+
+def read_png(path):
+    """Return (width, height, list of (r, g, b, a) tuples)"""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:8] != b'\x89PNG\r\n\x1a\n':
+        raise ValueError('%s is not a PNG file' % path)
+
+    pos = 8
+    idat = bytearray()
+    palette = []
+    trns = b''
+    while pos < len(data):
+        length, kind = struct.unpack('>I4s', data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b'IHDR':
+            w, h, bit_depth, color_type, _, _, interlace = struct.unpack('>IIBBBBB', chunk)
+        elif kind == b'PLTE':
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b'tRNS':
+            trns = chunk
+        elif kind == b'IDAT':
+            idat += chunk
+        elif kind == b'IEND':
+            break
+
+    if interlace:
+        raise ValueError('%s: interlaced PNGs are not supported' % path)
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    bits_per_px = channels * bit_depth
+    bpp = max(1, bits_per_px // 8)             # Distance of the bytes used by the filters
+    stride = (w * bits_per_px + 7) // 8
+    raw = zlib.decompress(bytes(idat))
+
+    rows = []
+    prev = bytearray(stride)
+    for y in range(h):
+        filt = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if filt == 1:
+                line[i] = (line[i] + a) & 0xff
+            elif filt == 2:
+                line[i] = (line[i] + b) & 0xff
+            elif filt == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xff
+            elif filt == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xff
+        rows.append(line)
+        prev = line
+
+    def samples(line):
+        """The channel values of a row scaled to 8 bit"""
+        if bit_depth == 8:
+            return list(line)
+        if bit_depth == 16:
+            return [line[i] for i in range(0, len(line), 2)]
+        per_byte = 8 // bit_depth
+        mask = (1 << bit_depth) - 1
+        out = []
+        for byte in line:
+            for k in range(per_byte):
+                out.append((byte >> (8 - bit_depth * (k + 1))) & mask)
+        return out
+
+    pixels = []
+    for line in rows:
+        s = samples(line)
+        for x in range(w):
+            v = s[x * channels:(x + 1) * channels]
+            if color_type == 3:
+                r, g, b = palette[v[0]]
+                a = trns[v[0]] if v[0] < len(trns) else 0xff
+            else:
+                if bit_depth < 8:
+                    v = [c * 255 // ((1 << bit_depth) - 1) for c in v]
+                if color_type == 0:
+                    r = g = b = v[0]
+                    a = 0xff
+                elif color_type == 2:
+                    r, g, b = v
+                    a = 0xff
+                elif color_type == 4:
+                    r = g = b = v[0]
+                    a = v[1]
+                else:
+                    r, g, b, a = v
+            # The color of the transparent pixels doesn't matter, so they need only one palette entry
+            pixels.append((r, g, b, a) if a else (0, 0, 0, 0))
+
+    return w, h, pixels
+
+
+def color_bytes(r, g, b, depth, swap):
+    """The bytes of an lv_color_t, like the online image converter makes them"""
+    if depth == 32:
+        return bytes((b, g, r, 0xff))
+    if depth == 16:
+        c = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        return bytes((c >> 8, c & 0xff)) if swap else bytes((c & 0xff, c >> 8))
+    # 8 and 1 bit use the same RGB332 format in the images
+    return bytes(((r & 0xe0) | ((g & 0xe0) >> 3) | (b >> 6),))
+
+
+def color_key(px, depth, swap):
+    return color_bytes(px[0], px[1], px[2], depth, swap)
+
+
+def encode(cf, w, pixels, depth, swap):
+    """Return the image data in the given color format"""
+    out = bytearray()
+    if cf == 'true_color':
+        for r, g, b, _ in pixels:
+            out += color_bytes(r, g, b, depth, swap)
+    elif cf == 'true_color_chroma_keyed':
+        for r, g, b, a in pixels:
+            out += color_bytes(*(CHROMA_KEY if a == 0 else (r, g, b)), depth=depth, swap=swap)
+    elif cf == 'true_color_alpha':
+        for r, g, b, a in pixels:
+            px = color_bytes(r, g, b, depth, swap)
+            out += (px[:3] if depth == 32 else px) + bytes((a,))
+    elif cf.startswith('indexed_'):
+        bits = int(cf[8])
+        palette, index = make_palette(pixels, 1 << bits, depth, swap)
+        for r, g, b, a in palette:
+            out += bytes((b, g, r, a))
+        out += bytes(4 * ((1 << bits) - len(palette)))
+        out += pack_bits([index[px] for px in pixels], w, bits)
+    elif cf.startswith('alpha_'):
+        bits = int(cf[6])
+        out += pack_bits([px[3] >> (8 - bits) for px in pixels], w, bits)
+    else:
+        raise ValueError('Unknown color format: ' + cf)
+    return bytes(out)
+
+
+def make_palette(pixels, max_cnt, depth, swap):
+    """
+    Return (palette, pixel -> index). The pixels of the same color after the conversion to the color depth
+    share an entry. If there are more colors than `max_cnt` the most frequent ones are kept
+    and the others use the closest one.
+    """
+    cnt = {}
+    first = {}
+    for px in pixels:
+        key = color_key(px, depth, swap) + bytes((px[3],))
+        cnt[key] = cnt.get(key, 0) + 1
+        first.setdefault(key, px)
+
+    keys = sorted(cnt, key=lambda k: cnt[k], reverse=True)
+    if len(keys) > max_cnt:
+        sys.stderr.write('Warning: the image has %d colors, only the %d most frequent are kept\n' % (len(keys), max_cnt))
+        keys = keys[:max_cnt]
+    palette = [first[k] for k in keys]
+    key_index = {k: i for i, k in enumerate(keys)}
+
+    index = {}
+    for px in set(pixels):
+        key = color_key(px, depth, swap) + bytes((px[3],))
+        if key in key_index:
+            index[px] = key_index[key]
+        else:
+            index[px] = min(range(len(palette)), key=lambda i: sum((a - b) ** 2 for a, b in zip(px, palette[i])))
+    return palette, index
+
+
+def pack_bits(values, w, bits):
+    """Pack the values MSB first, every row starts on a new byte"""
+    out = bytearray()
+    per_byte = 8 // bits
+    for y in range(len(values) // w):
+        row = values[y * w:(y + 1) * w]
+        for x in range(0, w, per_byte):
+            byte = 0
+            for k, v in enumerate(row[x:x + per_byte]):
+                byte |= v << (8 - bits * (k + 1))
+            out.append(byte)
+    return out
+
+
+def lossless_formats(pixels, depth, swap):
+    """The color formats which show the image without loss, in order of preference if they have the same size"""
+    alphas = set(px[3] for px in pixels)
+    opaque = alphas == {0xff}
+    colors = set(color_key(px, depth, swap) + bytes((px[3],)) for px in pixels)
+
+    formats = []
+    if opaque:
+        formats.append('true_color')
+    key = color_bytes(*CHROMA_KEY, depth=depth, swap=swap)
+    if alphas <= {0, 0xff} and not any(px[3] and color_key(px, depth, swap) == key for px in pixels):
+        formats.append('true_color_chroma_keyed')
+    for bits in (1, 2, 4, 8):
+        if len(colors) <= 1 << bits:
+            formats.append('indexed_%dbit' % bits)
+    formats.append('true_color_alpha')
+    return formats
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--depth', type=int, required=True, choices=(1, 8, 16, 32))
+    parser.add_argument('--swap', action='store_true', help='LV_COLOR_16_SWAP')
+    parser.add_argument('--cf', default='auto', choices=COLOR_FORMATS)
+    parser.add_argument('--name', help='name of the lv_img_dsc_t (default: the output file\'s name)')
+    parser.add_argument('--conf', default=os.path.join(os.path.dirname(__file__), '..', 'lv_demo.h'),
+                        help='header to include')
+    parser.add_argument('input')
+    parser.add_argument('output_c')
+    args = parser.parse_args()
+
+    name = args.name or os.path.splitext(os.path.basename(args.output_c))[0]
+    w, h, pixels = read_png(args.input)
+
+    cf = args.cf
+    if cf == 'auto':
+        sizes = [(len(encode(f, w, pixels, args.depth, args.swap)), f)
+                 for f in lossless_formats(pixels, args.depth, args.swap)]
+        cf = min(sizes, key=lambda s: s[0])[1]      # min() keeps the first of the same sizes
+    data = encode(cf, w, pixels, args.depth, args.swap)
+
+    lines = []
+    for i in range(0, len(data), 32):
+        lines.append('  ' + ', '.join('0x%02x' % b for b in data[i:i + 32]) + ',')
+
+    attr = 'LV_ATTRIBUTE_IMG_' + name.upper()
+    conf = os.path.abspath(args.conf).replace('\\', '/')
+    with open(args.output_c, 'w') as f:
+        f.write('''/*Generated by png_to_c.py from {src} ({cf}, {size} bytes). Don't edit.*/
+#include "{conf}"
+
+#if LV_COLOR_DEPTH != {depth} || (LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != {swap})
+#error "{base} was generated for an other color format. Generate it again."
+#endif
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef {attr}
+#define {attr}
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST {attr} uint8_t {name}_map[] = {{
+{data}
+}};
+
+const lv_img_dsc_t {name} = {{
+  .header.always_zero = 0,
+  .header.w = {w},
+  .header.h = {h},
+  .data_size = {size},
+  .header.cf = LV_IMG_CF_{CF},
+  .data = {name}_map,
+}};
+'''.format(src=os.path.basename(args.input), cf=cf, size=len(data), conf=conf, depth=args.depth,
+           swap=1 if args.swap else 0, base=os.path.basename(args.output_c), attr=attr, name=name,
+           data='\n'.join(lines), w=w, h=h, CF=cf.upper()))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
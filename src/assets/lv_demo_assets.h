@@ -0,0 +1,43 @@
+/**
+ * @file lv_demo_assets.h
+ * Assets used by more demos. Every asset is defined only once here.
+ */
+
+#ifndef LV_DEMO_ASSETS_H
+#define LV_DEMO_ASSETS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_demo.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/*Compressed fonts with the `a-z` characters*/
+LV_FONT_DECLARE(lv_font_montserrat_12_compr_az);
+LV_FONT_DECLARE(lv_font_montserrat_16_compr_az);
+LV_FONT_DECLARE(lv_font_montserrat_28_compr_az);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DEMO_ASSETS_H*/
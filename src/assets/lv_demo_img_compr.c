@@ -0,0 +1,373 @@
+/**
+ * @file lv_demo_img_compr.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_demo_img_compr.h"
+
+#if LV_DEMO_USE_IMG_COMPR
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const lv_img_dsc_t * src;   /*The compressed image*/
+    uint8_t * buf;              /*The decoded pixels*/
+    uint32_t size;              /*Size of `buf` [bytes]*/
+    uint32_t ref_cnt;           /*Number of decoder descriptors using `buf`. Only unused images are dropped.*/
+} img_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_res_t decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header);
+static lv_res_t decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static void decoder_close(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc);
+static bool get_header(const void * src, lv_demo_img_compr_header_t * header);
+static uint32_t get_px_size(lv_img_cf_t cf);
+static bool rle_decode(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size, uint32_t px_size);
+static bool lz4_decode(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size);
+static void make_room(uint32_t size);
+static void drop(img_entry_t * e);
+static uint32_t clock_get(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_img_decoder_t * decoder;
+static lv_ll_t entries;         /*The most recently used image is the head*/
+static lv_demo_img_compr_stat_t stat;
+static lv_demo_img_compr_clock_cb_t clock_cb;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_demo_img_compr_init(uint32_t size_limit)
+{
+    stat.cache_size_limit = size_limit;
+
+    if(decoder == NULL) {
+        _lv_ll_init(&entries, sizeof(img_entry_t));
+
+        /*The newest decoder is tried first, so the other images cost only a color format check*/
+        decoder = lv_img_decoder_create();
+        LV_ASSERT_MALLOC(decoder);
+        if(decoder == NULL) return;
+        lv_img_decoder_set_info_cb(decoder, decoder_info);
+        lv_img_decoder_set_open_cb(decoder, decoder_open);
+        lv_img_decoder_set_close_cb(decoder, decoder_close);
+    }
+
+    make_room(0);
+}
+
+void lv_demo_img_compr_clear(void)
+{
+    img_entry_t * e = _lv_ll_get_tail(&entries);
+    while(e) {
+        img_entry_t * prev = _lv_ll_get_prev(&entries, e);
+        if(e->ref_cnt == 0) drop(e);
+        e = prev;
+    }
+}
+
+void lv_demo_img_compr_set_clock_cb(lv_demo_img_compr_clock_cb_t cb)
+{
+    clock_cb = cb;
+}
+
+void lv_demo_img_compr_get_stat(lv_demo_img_compr_stat_t * s)
+{
+    *s = stat;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_res_t decoder_info(lv_img_decoder_t * dec, const void * src, lv_img_header_t * header)
+{
+    LV_UNUSED(dec);
+
+    lv_demo_img_compr_header_t compr_header;
+    if(!get_header(src, &compr_header)) return LV_RES_INV;
+
+    const lv_img_dsc_t * img = src;
+    header->always_zero = 0;
+    header->w = img->header.w;
+    header->h = img->header.h;
+    header->cf = compr_header.cf;     /*Drawn as the decoded color format*/
+
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(dec);
+
+    lv_demo_img_compr_header_t compr_header;
+    if(!get_header(dsc->src, &compr_header)) return LV_RES_INV;
+
+    const lv_img_dsc_t * img = dsc->src;
+
+    img_entry_t * e;
+    _LV_LL_READ(&entries, e) {
+        if(e->src == img) {
+            stat.hit_cnt++;
+            img_entry_t * head = _lv_ll_get_head(&entries);
+            if(e != head) _lv_ll_move_before(&entries, e, head);
+            break;
+        }
+    }
+
+    if(e == NULL) {
+        stat.miss_cnt++;
+
+        make_room(compr_header.decoded_size);
+        uint8_t * buf = lv_mem_alloc(compr_header.decoded_size);
+        if(buf == NULL) {
+            LV_LOG_WARN("no memory to decode a %dx%d image", img->header.w, img->header.h);
+            return LV_RES_INV;
+        }
+
+        uint32_t t = clock_get();
+        const uint8_t * in = img->data + sizeof(lv_demo_img_compr_header_t);
+        uint32_t in_size = img->data_size - sizeof(lv_demo_img_compr_header_t);
+        bool ok;
+        if(compr_header.method == LV_DEMO_IMG_COMPR_RLE) {
+            ok = rle_decode(in, in_size, buf, compr_header.decoded_size, get_px_size(compr_header.cf));
+        }
+        else {
+            ok = lz4_decode(in, in_size, buf, compr_header.decoded_size);
+        }
+        t = clock_get() - t;
+
+        if(!ok) {
+            LV_LOG_WARN("a compressed image is corrupted");
+            lv_mem_free(buf);
+            return LV_RES_INV;
+        }
+
+        e = _lv_ll_ins_head(&entries);
+        if(e == NULL) {
+            lv_mem_free(buf);
+            return LV_RES_INV;
+        }
+
+        e->src = img;
+        e->buf = buf;
+        e->size = compr_header.decoded_size;
+        e->ref_cnt = 0;
+
+        stat.decode_time += t;
+        if(t > stat.decode_time_max) stat.decode_time_max = t;
+        stat.decoded_size += e->size;
+        stat.cache_size += e->size;
+        if(stat.cache_size > stat.cache_size_max) stat.cache_size_max = stat.cache_size;
+    }
+
+    e->ref_cnt++;
+    dsc->user_data = e;
+    dsc->img_data = e->buf;
+    return LV_RES_OK;
+}
+
+static void decoder_close(lv_img_decoder_t * dec, lv_img_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(dec);
+
+    img_entry_t * e = dsc->user_data;
+    if(e == NULL) return;
+
+    e->ref_cnt--;
+    dsc->user_data = NULL;
+    dsc->img_data = NULL;
+
+    /*An image larger than the budget stays only while it's used*/
+    make_room(0);
+}
+
+/**
+ * Get the header of a compressed image
+ * @param src       source of an image
+ * @param header    the header is copied here as the data might be not aligned
+ * @return          true: `src` is a valid compressed image
+ */
+static bool get_header(const void * src, lv_demo_img_compr_header_t * header)
+{
+    if(lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE) return false;
+
+    const lv_img_dsc_t * img = src;
+    if(img->header.cf != LV_IMG_CF_USER_ENCODED_0) return false;
+    if(img->data_size < sizeof(lv_demo_img_compr_header_t)) return false;
+
+    lv_memcpy(header, img->data, sizeof(lv_demo_img_compr_header_t));
+
+    uint32_t px_size = get_px_size(header->cf);
+    if(px_size == 0 || header->decoded_size != (uint32_t)img->header.w * img->header.h * px_size) {
+        LV_LOG_WARN("the compressed image was made for an other color format");
+        return false;
+    }
+
+    if(header->method != LV_DEMO_IMG_COMPR_RLE && header->method != LV_DEMO_IMG_COMPR_LZ4) {
+        LV_LOG_WARN("unknown compression: %d", header->method);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Only the true color formats are supported as LVGL draws them directly from the decoded buffer
+ */
+static uint32_t get_px_size(lv_img_cf_t cf)
+{
+    switch(cf) {
+        case LV_IMG_CF_TRUE_COLOR:
+        case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+            return LV_COLOR_SIZE / 8;
+        case LV_IMG_CF_TRUE_COLOR_ALPHA:
+            return LV_IMG_PX_SIZE_ALPHA_BYTE;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Decode the RLE format of img_compress.py. Every run starts with a control byte:
+ * bit 7 = 1: (bits 0..6) + 1 times the next pixel, bit 7 = 0: (bits 0..6) + 1 literal pixels follow.
+ */
+static bool rle_decode(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size, uint32_t px_size)
+{
+    const uint8_t * in_end = in + in_size;
+    const uint8_t * out_end = out + out_size;
+
+    while(in < in_end) {
+        uint8_t ctrl = *in++;
+        uint32_t size = ((ctrl & 0x7f) + 1) * px_size;
+        if(size > (uint32_t)(out_end - out)) return false;
+
+        if(ctrl & 0x80) {
+            if(px_size > (uint32_t)(in_end - in)) return false;
+            const uint8_t * run_end = out + size;
+            while(out < run_end) {
+                lv_memcpy(out, in, px_size);
+                out += px_size;
+            }
+            in += px_size;
+        }
+        else {
+            if(size > (uint32_t)(in_end - in)) return false;
+            lv_memcpy(out, in, size);
+            out += size;
+            in += size;
+        }
+    }
+
+    return out == out_end;
+}
+
+/**
+ * Decode an LZ4 block. Every sequence is a token (literal length << 4 | match length - 4),
+ * the extra bytes of the literal length, the literals, a 2 byte offset and the extra bytes of the match length.
+ * The last sequence has only literals.
+ */
+static bool lz4_decode(const uint8_t * in, uint32_t in_size, uint8_t * out, uint32_t out_size)
+{
+    const uint8_t * in_end = in + in_size;
+    const uint8_t * out_start = out;
+    const uint8_t * out_end = out + out_size;
+
+    while(in < in_end) {
+        uint8_t token = *in++;
+
+        uint32_t len = token >> 4;
+        if(len == 15) {
+            uint8_t b;
+            do {
+                if(in >= in_end) return false;
+                b = *in++;
+                len += b;
+            } while(b == 255);
+        }
+        if(len > (uint32_t)(in_end - in) || len > (uint32_t)(out_end - out)) return false;
+        lv_memcpy(out, in, len);
+        out += len;
+        in += len;
+
+        if(in == in_end) break;
+
+        if(in_end - in < 2) return false;
+        uint32_t offset = in[0] | (in[1] << 8);
+        in += 2;
+        if(offset == 0 || offset > (uint32_t)(out - out_start)) return false;
+
+        len = (token & 0xf) + 4;
+        if((token & 0xf) == 15) {
+            uint8_t b;
+            do {
+                if(in >= in_end) return false;
+                b = *in++;
+                len += b;
+            } while(b == 255);
+        }
+        if(len > (uint32_t)(out_end - out)) return false;
+
+        /*Byte by byte as the match can overlap the output, e.g. offset 2 repeats a 16 bit pixel*/
+        const uint8_t * match = out - offset;
+        while(len) {
+            *out++ = *match++;
+            len--;
+        }
+    }
+
+    return out == out_end;
+}
+
+/**
+ * Drop the least recently used images which are not shown until `size` more bytes fit into the budget
+ */
+static void make_room(uint32_t size)
+{
+    img_entry_t * e = _lv_ll_get_tail(&entries);
+    while(e && stat.cache_size + size > stat.cache_size_limit) {
+        img_entry_t * prev = _lv_ll_get_prev(&entries, e);
+        if(e->ref_cnt == 0) {
+            drop(e);
+            stat.evict_cnt++;
+        }
+        e = prev;
+    }
+}
+
+static void drop(img_entry_t * e)
+{
+    stat.cache_size -= e->size;
+    lv_mem_free(e->buf);
+    _lv_ll_remove(&entries, e);
+    lv_mem_free(e);
+}
+
+/**
+ * Get the time for the decoding time
+ * @return      the time from `clock_cb` or from the tick [us]
+ */
+static uint32_t clock_get(void)
+{
+    if(clock_cb) return clock_cb();
+    else return lv_tick_get() * 1000;
+}
+
+#endif /*LV_DEMO_USE_IMG_COMPR*/
@@ -0,0 +1,105 @@
+/**
+ * @file lv_demo_img_compr.h
+ * Decoder of the compressed images made by scripts/img_compress.py.
+ *
+ * A compressed image has the LV_IMG_CF_USER_ENCODED_0 color format and its data is
+ * an lv_demo_img_compr_header_t followed by the compressed pixels.
+ * The decoded images are kept in an LRU cache with a byte budget, so e.g. an album cover
+ * is decoded only once when its track is shown and not on every redraw.
+ */
+
+#ifndef LV_DEMO_IMG_COMPR_H
+#define LV_DEMO_IMG_COMPR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_demo.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef LV_DEMO_USE_IMG_COMPR
+#define LV_DEMO_USE_IMG_COMPR           0
+#endif
+
+#ifndef LV_DEMO_IMG_COMPR_CACHE_SIZE
+#define LV_DEMO_IMG_COMPR_CACHE_SIZE    (128 * 1024)
+#endif
+
+#define LV_DEMO_IMG_COMPR_RLE   1
+#define LV_DEMO_IMG_COMPR_LZ4   2
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Return a time in microseconds. Only the difference of two calls is used so it can overflow.*/
+typedef uint32_t (*lv_demo_img_compr_clock_cb_t)(void);
+
+typedef struct {
+    uint8_t method;             /*LV_DEMO_IMG_COMPR_...*/
+    uint8_t cf;                 /*Color format of the decoded image (lv_img_cf_t)*/
+    uint16_t reserved;
+    uint32_t decoded_size;      /*Size of the decoded pixels [bytes]*/
+} lv_demo_img_compr_header_t;
+
+typedef struct {
+    uint32_t hit_cnt;           /*Opened images which were in the cache*/
+    uint32_t miss_cnt;          /*Opened images which had to be decoded*/
+    uint32_t evict_cnt;         /*Images dropped from the cache to fit the budget*/
+    uint32_t decode_time;       /*Sum of the decoding times [us]*/
+    uint32_t decode_time_max;   /*The longest decoding [us]*/
+    uint32_t decoded_size;      /*Sum of the decoded bytes*/
+    uint32_t cache_size;        /*Size of the decoded images in the cache now [bytes]*/
+    uint32_t cache_size_max;    /*The largest `cache_size` so far [bytes]*/
+    uint32_t cache_size_limit;  /*The budget of the cache [bytes]*/
+} lv_demo_img_compr_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_DEMO_USE_IMG_COMPR
+
+/**
+ * Register the decoder of the compressed images. Call it after `lv_init()`.
+ * Calling it again only changes the budget.
+ * @param size_limit    max. size of the decoded images in the cache [bytes].
+ *                      The least recently used images which are not shown are dropped.
+ */
+void lv_demo_img_compr_init(uint32_t size_limit);
+
+/**
+ * Free the cached images which are not shown now. The statistics are kept.
+ */
+void lv_demo_img_compr_clear(void);
+
+/**
+ * Set a more precise clock to measure the decoding time.
+ * By default `lv_tick_get()` is used which has only millisecond resolution, too coarse for most images.
+ * @param clock_cb      pointer to a callback or NULL to use `lv_tick_get()`
+ */
+void lv_demo_img_compr_set_clock_cb(lv_demo_img_compr_clock_cb_t clock_cb);
+
+/**
+ * Get the statistics of the decoder and its cache
+ * @param stat      the statistics are copied here
+ */
+void lv_demo_img_compr_get_stat(lv_demo_img_compr_stat_t * stat);
+
+#endif /*LV_DEMO_USE_IMG_COMPR*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DEMO_IMG_COMPR_H*/
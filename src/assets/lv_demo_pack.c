@@ -0,0 +1,224 @@
+/**
+ * @file lv_demo_pack.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_demo_pack.h"
+
+#if LV_DEMO_USE_PACK
+
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LV_DEMO_PACK_MMAP   1
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#define LV_DEMO_PACK_MMAP   0
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool pack_check(const uint8_t * addr, uint32_t size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const uint8_t * pack_addr;
+static const lv_demo_pack_entry_t * entries;
+static uint32_t entry_cnt;
+static lv_img_dsc_t * img_dscs;     /*The descriptors are built on load, they point to the pack's pixels*/
+static bool mapped;
+static uint32_t mapped_size;
+
+/*Returned for the missing images. 0x0 px, so nothing is drawn.*/
+static const lv_img_dsc_t empty_img = {
+    .header.always_zero = 0,
+    .header.w = 0,
+    .header.h = 0,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .data_size = 0,
+    .data = NULL,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool lv_demo_pack_open(const char * path)
+{
+#if LV_DEMO_PACK_MMAP
+    lv_demo_pack_close();
+
+    int fd = open(path, O_RDONLY);
+    if(fd < 0) {
+        LV_LOG_WARN("couldn't open %s", path);
+        return false;
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(lv_demo_pack_header_t) || st.st_size > UINT32_MAX) {
+        LV_LOG_WARN("%s is not an asset pack", path);
+        close(fd);
+        return false;
+    }
+
+    /*The pages are loaded only when the pixels are drawn*/
+    void * addr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if(addr == MAP_FAILED) {
+        LV_LOG_WARN("couldn't map %s", path);
+        return false;
+    }
+
+    if(!lv_demo_pack_set(addr, (uint32_t)st.st_size)) {
+        munmap(addr, st.st_size);
+        return false;
+    }
+
+    mapped = true;
+    mapped_size = (uint32_t)st.st_size;
+    return true;
+#else
+    LV_UNUSED(path);
+    LV_LOG_WARN("no mmap, use lv_demo_pack_set() with the address of the pack");
+    return false;
+#endif
+}
+
+bool lv_demo_pack_set(const void * addr, uint32_t size)
+{
+    lv_demo_pack_close();
+
+    if(!pack_check(addr, size)) return false;
+
+    const lv_demo_pack_header_t * header = addr;
+    const lv_demo_pack_entry_t * e = (const lv_demo_pack_entry_t *)((const uint8_t *)addr + sizeof(lv_demo_pack_header_t));
+
+    img_dscs = lv_mem_alloc(header->entry_cnt * sizeof(lv_img_dsc_t));
+    LV_ASSERT_MALLOC(img_dscs);
+    if(img_dscs == NULL) return false;
+
+    uint32_t i;
+    for(i = 0; i < header->entry_cnt; i++) {
+        lv_img_dsc_t * dsc = &img_dscs[i];
+        lv_memset_00(dsc, sizeof(lv_img_dsc_t));
+        dsc->header.cf = e[i].cf;
+        dsc->header.w = e[i].w;
+        dsc->header.h = e[i].h;
+        dsc->data_size = e[i].size;
+        dsc->data = (const uint8_t *)addr + e[i].offset;
+    }
+
+    pack_addr = addr;
+    entries = e;
+    entry_cnt = header->entry_cnt;
+    return true;
+}
+
+void lv_demo_pack_close(void)
+{
+#if LV_DEMO_PACK_MMAP
+    if(mapped) munmap((void *)pack_addr, mapped_size);
+#endif
+    if(img_dscs) lv_mem_free(img_dscs);
+
+    pack_addr = NULL;
+    entries = NULL;
+    entry_cnt = 0;
+    img_dscs = NULL;
+    mapped = false;
+    mapped_size = 0;
+}
+
+const lv_img_dsc_t * lv_demo_pack_get_img(const char * name)
+{
+    /*The index is sorted by name*/
+    int32_t first = 0;
+    int32_t last = (int32_t)entry_cnt - 1;
+    while(first <= last) {
+        int32_t mid = (first + last) / 2;
+        int cmp = strncmp(name, entries[mid].name, LV_DEMO_PACK_NAME_MAX);
+        if(cmp == 0) {
+            if(entries[mid].type == LV_DEMO_PACK_TYPE_IMG) return &img_dscs[mid];
+            break;
+        }
+        if(cmp < 0) last = mid - 1;
+        else first = mid + 1;
+    }
+
+    LV_LOG_WARN("%s is not in the asset pack", name);
+    return &empty_img;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Check that the pack is made for this color format, all the entries are inside the pack
+ * and they have all the pixels their header tells, so a broken or old pack can't make the demos read anywhere.
+ */
+static bool pack_check(const uint8_t * addr, uint32_t size)
+{
+    const lv_demo_pack_header_t * header = (const lv_demo_pack_header_t *)addr;
+    if(size < sizeof(lv_demo_pack_header_t) || header->magic != LV_DEMO_PACK_MAGIC) {
+        LV_LOG_WARN("not an asset pack");
+        return false;
+    }
+
+    if(header->version != LV_DEMO_PACK_VERSION) {
+        LV_LOG_WARN("the asset pack's version is %d instead of %d", header->version, LV_DEMO_PACK_VERSION);
+        return false;
+    }
+
+    if(header->color_depth != LV_COLOR_DEPTH || (LV_COLOR_DEPTH == 16 && header->color_16_swap != LV_COLOR_16_SWAP)) {
+        LV_LOG_WARN("the asset pack was made for an other color format (%d bit)", header->color_depth);
+        return false;
+    }
+
+    uint32_t index_end = sizeof(lv_demo_pack_header_t) + header->entry_cnt * sizeof(lv_demo_pack_entry_t);
+    if(header->size > size || index_end > header->size) {
+        LV_LOG_WARN("the asset pack is truncated");
+        return false;
+    }
+
+    const lv_demo_pack_entry_t * e = (const lv_demo_pack_entry_t *)(addr + sizeof(lv_demo_pack_header_t));
+    uint32_t i;
+    for(i = 0; i < header->entry_cnt; i++) {
+        if(e[i].offset < index_end || e[i].offset > header->size || e[i].size > header->size - e[i].offset ||
+           e[i].name[LV_DEMO_PACK_NAME_MAX - 1] != '\0') {
+            LV_LOG_WARN("entry %d of the asset pack is invalid", i);
+            return false;
+        }
+
+        /*The image decoder reads as many bytes as the header tells, not `size`*/
+        if(e[i].type != LV_DEMO_PACK_TYPE_IMG || e[i].cf < LV_IMG_CF_TRUE_COLOR || e[i].cf > LV_IMG_CF_ALPHA_8BIT ||
+           e[i].size < lv_img_buf_get_img_size(e[i].w, e[i].h, e[i].cf)) {
+            LV_LOG_WARN("image %d of the asset pack has an unknown type or color format or its data is too short", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif /*LV_DEMO_USE_PACK*/
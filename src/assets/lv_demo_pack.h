@@ -0,0 +1,117 @@
+/**
+ * @file lv_demo_pack.h
+ * Load the demos' images from an asset pack file instead of compiling them into the binary.
+ * The pack is memory mapped and the pixels are used in place, nothing is copied.
+ *
+ * Layout of a pack (little endian, made by scripts/asset_pack.py):
+ *   lv_demo_pack_header_t
+ *   lv_demo_pack_entry_t[entry_cnt]     the index, sorted by name
+ *   the data of the entries, every one aligned to LV_DEMO_PACK_ALIGN bytes
+ */
+
+#ifndef LV_DEMO_PACK_H
+#define LV_DEMO_PACK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_demo.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef LV_DEMO_USE_PACK
+#define LV_DEMO_USE_PACK        0
+#endif
+
+#define LV_DEMO_PACK_MAGIC      0x4B415044      /*"DPAK"*/
+#define LV_DEMO_PACK_VERSION    1
+#define LV_DEMO_PACK_ALIGN      64              /*Alignment of the data, enough for DMA and cache lines*/
+#define LV_DEMO_PACK_NAME_MAX   40
+
+#define LV_DEMO_PACK_TYPE_IMG   1
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t magic;             /*LV_DEMO_PACK_MAGIC*/
+    uint16_t version;           /*LV_DEMO_PACK_VERSION*/
+    uint16_t entry_cnt;
+    uint8_t color_depth;        /*LV_COLOR_DEPTH of the images*/
+    uint8_t color_16_swap;      /*LV_COLOR_16_SWAP of the images*/
+    uint16_t reserved;
+    uint32_t size;              /*Size of the whole pack [bytes]*/
+} lv_demo_pack_header_t;
+
+typedef struct {
+    char name[LV_DEMO_PACK_NAME_MAX];   /*Name of the asset, e.g. "img_lv_demo_music_cover_1", '\0' terminated*/
+    uint8_t type;               /*LV_DEMO_PACK_TYPE_...*/
+    uint8_t cf;                 /*lv_img_cf_t*/
+    uint16_t w;
+    uint16_t h;
+    uint16_t reserved;
+    uint32_t offset;            /*Offset of the data from the beginning of the pack*/
+    uint32_t size;              /*Size of the data [bytes]*/
+} lv_demo_pack_entry_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_DEMO_USE_PACK
+
+/**
+ * Map a pack file to the memory and use its images. Needs `mmap` (Linux and other POSIX systems).
+ * @param path      path of the pack file
+ * @return          true: the pack is usable
+ */
+bool lv_demo_pack_open(const char * path);
+
+/**
+ * Use a pack which is already in the address space, e.g. on a memory mapped QSPI flash
+ * @param addr      address of the pack, should be aligned to LV_DEMO_PACK_ALIGN
+ * @param size      size of the pack's memory area [bytes]
+ * @return          true: the pack is usable
+ */
+bool lv_demo_pack_set(const void * addr, uint32_t size);
+
+/**
+ * Forget the pack and unmap it if it was opened with `lv_demo_pack_open()`.
+ * The images of the pack can't be used after it.
+ */
+void lv_demo_pack_close(void);
+
+/**
+ * Get an image from the pack
+ * @param name      name of the image, the same as the name of its `lv_img_dsc_t` (e.g. "img_lv_demo_music_logo")
+ * @return          the image's descriptor. If there is no such image an empty (0x0 px) image.
+ */
+const lv_img_dsc_t * lv_demo_pack_get_img(const char * name);
+
+#endif /*LV_DEMO_USE_PACK*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**
+ * Get an image declared with `LV_IMG_DECLARE` from the pack if the pack is used, else the compiled-in one.
+ * E.g. `lv_img_set_src(img, LV_DEMO_IMG(img_lv_demo_music_logo));`
+ */
+#if LV_DEMO_USE_PACK
+#define LV_DEMO_IMG(name)   lv_demo_pack_get_img(#name)
+#else
+#define LV_DEMO_IMG(name)   (&(name))
+#endif
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DEMO_PACK_H*/
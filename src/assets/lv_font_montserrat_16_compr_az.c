@@ -7,7 +7,7 @@
  ******************************************************************************/
 
 #ifndef LV_FONT_MONTSERRAT_16_COMPR_AZ
-#define LV_FONT_MONTSERRAT_16_COMPR_AZ 1
+#define LV_FONT_MONTSERRAT_16_COMPR_AZ LV_USE_DEMO_BENCHMARK    /*Only the benchmark uses it*/
 #endif
 
 #if LV_FONT_MONTSERRAT_16_COMPR_AZ
@@ -320,7 +320,8 @@ static const lv_font_fmt_txt_kern_classes_t kern_classes =
  *--------------------*/
 
 /*Store all the custom data of the font*/
-static lv_font_fmt_txt_dsc_t font_dsc = {
+static lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
     .glyph_bitmap = gylph_bitmap,
     .glyph_dsc = glyph_dsc,
     .cmaps = cmaps,
@@ -329,7 +330,8 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .cmap_num = 2,
     .bpp = 4,
     .kern_classes = 1,
-    .bitmap_format = 1
+    .bitmap_format = 1,
+    .cache = &cache
 };
 
 
@@ -338,7 +340,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
  *----------------*/
 
 /*Initialize a public general font descriptor*/
-lv_font_t lv_font_montserrat_16_compr_az = {
+const lv_font_t lv_font_montserrat_16_compr_az = {
     .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
     .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
     .line_height = 15,          /*The maximum line height required by the font*/
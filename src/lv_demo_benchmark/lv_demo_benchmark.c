@@ -8,6 +8,8 @@
  *********************/
 #include "../../lv_demo.h"
 #include "lv_demo_benchmark.h"
+#include "lv_demo_font_cache.h"
+#include "../assets/lv_demo_assets.h"
 
 #if LV_USE_DEMO_BENCHMARK
 
@@ -43,6 +45,18 @@
 #define LINE_POINT_DIFF_MAX LV_MAX(LV_HOR_RES / (LINE_POINT_NUM + 2), LINE_POINT_DIFF_MIN * 2)
 #define ARC_WIDTH_THIN LV_MAX(LV_DPI_DEF / 50, 2)
 #define ARC_WIDTH_THICK LV_MAX(LV_DPI_DEF / 10, 5)
+#define TXT_LONG_PARAGRAPH "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. " \
+                           "Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat.\n"
+#define TXT_LONG_REPEAT     16      /*Results in a ~3.7 kB long text*/
+#define TXT_LONG_OBJ_NUM    2
+#define TXT_LONG_WIDTH_MIN  (LV_HOR_RES / 4)
+#define TXT_LONG_WIDTH_MAX  (LV_HOR_RES / 2)
+#define ROT_NUM             4       /*0, 90, 180, 270 degree*/
+#define IMG_CACHE_SIZE      LV_MAX(LV_IMG_CACHE_DEF_SIZE, 1)
+#define IMG_CACHE_SRC_MAX   32      /*Max. number of different image sources in the image cache scenes*/
+#ifndef LV_DEMO_BENCHMARK_GLYPH_CACHE_SIZE
+#define LV_DEMO_BENCHMARK_GLYPH_CACHE_SIZE  (8 * 1024)
+#endif
 /**********************
  *      TYPEDEFS
  **********************/
@@ -56,6 +70,17 @@ typedef struct {
     uint32_t refr_cnt_opa;
     uint32_t fps_normal;
     uint32_t fps_opa;
+    uint32_t layout_sum_normal;     /*Time spent with text layout (line breaking) [us]*/
+    uint32_t layout_sum_opa;
+    uint32_t layout_us_normal;      /*Average text layout time per refresh [us]*/
+    uint32_t layout_us_opa;
+    uint32_t rot_time_sum[ROT_NUM];     /*Sum of the normal and opa render times with each rotation [ms]*/
+    uint32_t rot_refr_cnt[ROT_NUM];
+    uint32_t rot_px_sum[ROT_NUM];
+    uint32_t img_draw_cnt;          /*Number of image draws, i.e. image cache lookups*/
+    uint32_t img_open_cnt;          /*Number of decoder opens, i.e. image cache misses*/
+    uint32_t img_open_time;         /*Time spent in the decoder's open [us]*/
+    lv_demo_font_cache_t * font_cache;  /*The glyph cache used in the scene*/
     uint8_t weight;
 }scene_dsc_t;
 
@@ -65,6 +90,9 @@ typedef struct {
 
 static lv_style_t style_common;
 static bool opa_mode = true;
+static lv_demo_font_cache_t font_cache_small;
+static lv_demo_font_cache_t font_cache_medium;
+static lv_demo_font_cache_t font_cache_large;
 
 LV_IMG_DECLARE(img_benchmark_cogwheel_argb);
 LV_IMG_DECLARE(img_benchmark_cogwheel_rgb);
@@ -72,18 +100,22 @@ LV_IMG_DECLARE(img_benchmark_cogwheel_chroma_keyed);
 LV_IMG_DECLARE(img_benchmark_cogwheel_indexed16);
 LV_IMG_DECLARE(img_benchmark_cogwheel_alpha16);
 
-LV_FONT_DECLARE(lv_font_montserrat_12_compr_az);
-LV_FONT_DECLARE(lv_font_montserrat_16_compr_az);
-LV_FONT_DECLARE(lv_font_montserrat_28_compr_az);
-
 static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px);
+static void benchmark_init(void);
 static void scene_next_task_cb(lv_timer_t * timer);
+static void scene_bg_refr_size(void);
+static void rotation_result_add(lv_obj_t * table, uint16_t row);
 static void rect_create(lv_style_t * style);
 static void img_create(lv_style_t * style, const void * src, bool rotate, bool zoom, bool aa);
+static void img_cache_create(lv_style_t * style, const lv_img_dsc_t * base, const char * path_fmt, uint32_t factor);
 static void txt_create(lv_style_t * style);
+static const lv_font_t * font_cache_get(lv_demo_font_cache_t * cache, const lv_font_t * base);
+static void txt_long_create(lv_style_t * style, lv_label_long_mode_t long_mode);
+static void textarea_long_create(lv_style_t * style);
 static void line_create(lv_style_t * style);
 static void arc_create(lv_style_t * style);
 static void fall_anim(lv_obj_t * obj);
+static void reflow_anim(lv_obj_t * obj);
 static void rnd_reset(void);
 static int32_t rnd_next(int32_t min, int32_t max);
 
@@ -311,6 +343,43 @@ static void img_index_recolor_cb(void)
 
 }
 
+static void img_cache_1x_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_img_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    img_cache_create(&style_common, &img_benchmark_cogwheel_indexed16, NULL, 1);
+}
+
+static void img_cache_2x_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_img_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    img_cache_create(&style_common, &img_benchmark_cogwheel_indexed16, NULL, 2);
+}
+
+static void img_cache_4x_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_img_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    img_cache_create(&style_common, &img_benchmark_cogwheel_indexed16, NULL, 4);
+}
+
+static void img_cache_argb_4x_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_img_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    img_cache_create(&style_common, &img_benchmark_cogwheel_argb, NULL, 4);
+}
+
+#ifdef LV_DEMO_BENCHMARK_IMG_CACHE_FILE_FMT
+static void img_cache_file_4x_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_img_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    img_cache_create(&style_common, NULL, LV_DEMO_BENCHMARK_IMG_CACHE_FILE_FMT, 4);
+}
+#endif
+
 static void img_rgb_rot_cb(void)
 {
     lv_style_reset(&style_common);
@@ -424,7 +493,61 @@ static void txt_large_compr_cb(void)
     txt_create(&style_common);
 
 }
+static void txt_small_compr_cached_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_text_font(&style_common, font_cache_get(&font_cache_small, &lv_font_montserrat_12_compr_az));
+    lv_style_set_text_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    txt_create(&style_common);
+}
+
+static void txt_medium_compr_cached_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_text_font(&style_common, font_cache_get(&font_cache_medium, &lv_font_montserrat_16_compr_az));
+    lv_style_set_text_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    txt_create(&style_common);
+}
+
+static void txt_large_compr_cached_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_text_font(&style_common, font_cache_get(&font_cache_large, &lv_font_montserrat_28_compr_az));
+    lv_style_set_text_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    txt_create(&style_common);
+}
 
+static void txt_long_wrap_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_text_font(&style_common, lv_theme_get_font_normal(NULL));
+    lv_style_set_text_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    txt_long_create(&style_common, LV_LABEL_LONG_WRAP);
+}
+
+static void txt_long_dot_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_text_font(&style_common, lv_theme_get_font_normal(NULL));
+    lv_style_set_text_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    txt_long_create(&style_common, LV_LABEL_LONG_DOT);
+}
+
+static void txt_long_scroll_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_text_font(&style_common, lv_theme_get_font_normal(NULL));
+    lv_style_set_text_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    txt_long_create(&style_common, LV_LABEL_LONG_SCROLL_CIRCULAR);
+}
+
+static void textarea_long_cb(void)
+{
+    lv_style_reset(&style_common);
+    lv_style_set_text_font(&style_common, lv_theme_get_font_normal(NULL));
+    lv_style_set_text_opa(&style_common, opa_mode ? LV_OPA_50 : LV_OPA_COVER);
+    textarea_long_create(&style_common);
+}
 
 static void line_cb(void)
 {
@@ -557,6 +680,14 @@ static scene_dsc_t scenes[] = {
         {.name = "Image chorma keyed recolor",   .weight = 3, .create_cb = img_ckey_recolor_cb},
         {.name = "Image indexed recolor",        .weight = 3, .create_cb = img_index_recolor_cb},
 
+        {.name = "Image cache 1x",               .weight = 5, .create_cb = img_cache_1x_cb},
+        {.name = "Image cache 2x",               .weight = 5, .create_cb = img_cache_2x_cb},
+        {.name = "Image cache 4x",               .weight = 3, .create_cb = img_cache_4x_cb},
+        {.name = "Image cache ARGB 4x",          .weight = 3, .create_cb = img_cache_argb_4x_cb},
+#ifdef LV_DEMO_BENCHMARK_IMG_CACHE_FILE_FMT
+        {.name = "Image cache file 4x",          .weight = 3, .create_cb = img_cache_file_4x_cb},
+#endif
+
         {.name = "Image RGB rotate",             .weight = 3, .create_cb = img_rgb_rot_cb},
         {.name = "Image RGB rotate anti aliased",  .weight = 3, .create_cb = img_rgb_rot_aa_cb},
         {.name = "Image ARGB rotate",            .weight = 5, .create_cb = img_argb_rot_cb},
@@ -574,6 +705,15 @@ static scene_dsc_t scenes[] = {
         {.name = "Text medium compressed",      .weight = 5, .create_cb = txt_medium_compr_cb},
         {.name = "Text large compressed",       .weight = 10, .create_cb = txt_large_compr_cb},
 
+        {.name = "Text small compressed cached",  .weight = 3, .create_cb = txt_small_compr_cached_cb, .font_cache = &font_cache_small},
+        {.name = "Text medium compressed cached", .weight = 5, .create_cb = txt_medium_compr_cached_cb, .font_cache = &font_cache_medium},
+        {.name = "Text large compressed cached",  .weight = 10, .create_cb = txt_large_compr_cached_cb, .font_cache = &font_cache_large},
+
+        {.name = "Text long wrap",              .weight = 10, .create_cb = txt_long_wrap_cb},
+        {.name = "Text long dot",               .weight = 5, .create_cb = txt_long_dot_cb},
+        {.name = "Text long scroll",            .weight = 3, .create_cb = txt_long_scroll_cb},
+        {.name = "Text area long",              .weight = 5, .create_cb = textarea_long_cb},
+
         {.name = "Line",                        .weight = 10, .create_cb = line_cb},
 
         {.name = "Arc think",                   .weight = 10, .create_cb = arc_think_cb},
@@ -591,10 +731,22 @@ static scene_dsc_t scenes[] = {
 };
 
 static int32_t scene_act = -1;
+static uint32_t scene_first;
+static uint32_t scene_end;      /*0: until the last scene*/
 static lv_obj_t * scene_bg;
 static lv_obj_t * title;
 static lv_obj_t * subtitle;
 static uint32_t rnd_act;
+static char txt_long[sizeof(TXT_LONG_PARAGRAPH) * TXT_LONG_REPEAT];
+static bool rotation_mode;
+static uint8_t rot_act;     /*The current `lv_disp_rot_t`*/
+static lv_img_decoder_t * cnt_decoder;
+static lv_demo_benchmark_finished_cb_t finished_cb;
+static lv_demo_benchmark_clock_cb_t clock_cb;
+static lv_img_dsc_t img_cache_dscs[IMG_CACHE_SRC_MAX];
+#ifdef LV_DEMO_BENCHMARK_IMG_CACHE_FILE_FMT
+static char img_cache_paths[IMG_CACHE_SRC_MAX][64];
+#endif
 
 
 static uint32_t rnd_map[] = {
@@ -626,30 +778,95 @@ static uint32_t rnd_map[] = {
 
 void lv_demo_benchmark(void)
 {
-    lv_disp_t * disp = lv_disp_get_next(NULL);
-    disp->driver->monitor_cb = monitor_cb;
+    benchmark_init();
 
-    lv_obj_t * scr = lv_scr_act();
-    lv_obj_remove_style_all(scr);
-    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    /*Manually start scenes*/
+    scene_next_task_cb(NULL);
+}
 
-    title = lv_label_create(scr);
-    lv_obj_set_pos(title, LV_DPI_DEF / 30, LV_DPI_DEF / 30);
+bool lv_demo_benchmark_load_scene(uint32_t id, bool opa)
+{
+    if(id >= lv_demo_benchmark_get_scene_cnt()) return false;
 
-    subtitle = lv_label_create(scr);
-    lv_obj_align_to(subtitle, title, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 0);
+    if(scene_bg == NULL) benchmark_init();
 
-    scene_bg = lv_obj_create(scr);
-    lv_obj_remove_style_all(scene_bg);
-    lv_obj_set_size(scene_bg, lv_obj_get_width(scr), lv_obj_get_height(scr) - subtitle->coords.y2 - LV_DPI_DEF / 30);
-    lv_obj_align(scene_bg, LV_ALIGN_BOTTOM_MID, 0, 0);
+    lv_obj_clean(scene_bg);
+    scene_act = id;
+    opa_mode = opa;
 
-    lv_style_init(&style_common);
+    lv_label_set_text_fmt(title, "%d: %s%s", id, scenes[id].name, opa ? " + opa" : "");
+    lv_label_set_text(subtitle, "");
 
-    lv_obj_update_layout(scr);
+    rnd_reset();
+    scenes[id].create_cb();
 
-    /*Manually start scenes*/
-    scene_next_task_cb(NULL);
+    return true;
+}
+
+void lv_demo_benchmark_set_finished_cb(lv_demo_benchmark_finished_cb_t cb)
+{
+    finished_cb = cb;
+}
+
+void lv_demo_benchmark_set_clock_cb(lv_demo_benchmark_clock_cb_t cb)
+{
+    clock_cb = cb;
+}
+
+/**
+ * Get the time for the fine measurements
+ * @return      the time from `clock_cb` or from the tick [us]
+ */
+uint32_t _lv_demo_benchmark_clock(void)
+{
+    if(clock_cb) return clock_cb();
+    else return lv_tick_get() * 1000;
+}
+
+bool lv_demo_benchmark_set_scene_range(uint32_t first, uint32_t end)
+{
+    if(first >= end || end > lv_demo_benchmark_get_scene_cnt()) return false;
+
+    scene_first = first;
+    scene_end = end;
+    return true;
+}
+
+uint32_t lv_demo_benchmark_get_scene_cnt(void)
+{
+    return sizeof(scenes) / sizeof(scene_dsc_t) - 1;
+}
+
+int32_t lv_demo_benchmark_get_scene_act(void)
+{
+    return scene_act;
+}
+
+bool lv_demo_benchmark_get_result(uint32_t id, lv_demo_benchmark_result_t * res)
+{
+    if(id >= lv_demo_benchmark_get_scene_cnt()) return false;
+
+    res->name = scenes[id].name;
+    res->fps_normal = scenes[id].fps_normal;
+    res->fps_opa = scenes[id].fps_opa;
+    res->time_sum_normal = scenes[id].time_sum_normal;
+    res->time_sum_opa = scenes[id].time_sum_opa;
+    res->refr_cnt_normal = scenes[id].refr_cnt_normal;
+    res->refr_cnt_opa = scenes[id].refr_cnt_opa;
+    res->weight = scenes[id].weight;
+    return true;
+}
+
+void lv_demo_benchmark_rotation(void)
+{
+    lv_disp_t * disp = lv_disp_get_next(NULL);
+    disp->driver->sw_rotate = 1;
+    lv_disp_set_rotation(disp, LV_DISP_ROT_NONE);
+
+    rotation_mode = true;
+    rot_act = LV_DISP_ROT_NONE;
+
+    lv_demo_benchmark();
 }
 
 /**********************
@@ -659,7 +876,16 @@ void lv_demo_benchmark(void)
 static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px)
 {
     LV_UNUSED(drv);
-    LV_UNUSED(px);
+    /*The summary is rendered after the last scene. Don't count it to a scene out of the range.*/
+    if(scene_act < (int32_t)scene_first || scene_act >= (int32_t)scene_end) return;
+
+    scenes[scene_act].rot_time_sum[rot_act] += time;
+    scenes[scene_act].rot_refr_cnt[rot_act] ++;
+    scenes[scene_act].rot_px_sum[rot_act] += px;
+
+    /*The rotated passes are only in the `rot_...` sums, so the results stay the unrotated ones*/
+    if(rot_act != LV_DISP_ROT_NONE) return;
+
     if(opa_mode) {
         scenes[scene_act].refr_cnt_opa ++;
         scenes[scene_act].time_sum_opa += time;
@@ -671,33 +897,92 @@ static void monitor_cb(lv_disp_drv_t * drv, uint32_t time, uint32_t px)
 //    lv_obj_invalidate(lv_scr_act());
 }
 
+static void benchmark_init(void)
+{
+    uint32_t scene_cnt = lv_demo_benchmark_get_scene_cnt();
+    if(scene_end == 0 || scene_end > scene_cnt) scene_end = scene_cnt;
+
+    lv_disp_t * disp = lv_disp_get_next(NULL);
+    disp->driver->monitor_cb = monitor_cb;
+
+    lv_obj_t * scr = lv_scr_act();
+    lv_obj_remove_style_all(scr);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+
+    title = lv_label_create(scr);
+    lv_obj_set_pos(title, LV_DPI_DEF / 30, LV_DPI_DEF / 30);
+
+    subtitle = lv_label_create(scr);
+    lv_obj_align_to(subtitle, title, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 0);
+
+    scene_bg = lv_obj_create(scr);
+    lv_obj_remove_style_all(scene_bg);
+    scene_bg_refr_size();
+
+    lv_style_init(&style_common);
+
+    lv_obj_update_layout(scr);
+}
+
 static void scene_next_task_cb(lv_timer_t * timer)
 {
     LV_UNUSED(timer);
     lv_obj_clean(scene_bg);
 
+    /*Remove the counting decoder of the image cache scenes, else it would open every image of the application.
+     *The cached images refer to it, so drop them first.*/
+    if(cnt_decoder) {
+        lv_img_cache_invalidate_src(NULL);
+        lv_img_decoder_delete(cnt_decoder);
+        cnt_decoder = NULL;
+    }
+
     if(opa_mode) {
-        if(scene_act >= 0) {
+        if(scene_act >= 0 && rot_act != LV_DISP_ROT_NONE) {
+            if(scene_act < (int32_t)scene_end) scene_act++;    /*Only the rotation's sums are collected*/
+        } else if(scene_act >= 0) {
             if(scenes[scene_act].time_sum_opa == 0) scenes[scene_act].time_sum_opa = 1;
             scenes[scene_act].fps_opa = (1000 * scenes[scene_act].refr_cnt_opa) / scenes[scene_act].time_sum_opa;
-            if(scenes[scene_act].create_cb) scene_act++;    /*If still there are scenes go to the next*/
+            if(scenes[scene_act].refr_cnt_opa) {
+                scenes[scene_act].layout_us_opa = scenes[scene_act].layout_sum_opa / scenes[scene_act].refr_cnt_opa;
+            }
+            if(scene_act < (int32_t)scene_end) scene_act++;    /*If still there are scenes go to the next*/
         } else {
-            scene_act ++;
+            scene_act = scene_first;
         }
         opa_mode = false;
+    } else if(rot_act != LV_DISP_ROT_NONE) {
+        opa_mode = true;
     } else {
         if(scenes[scene_act].time_sum_normal == 0) scenes[scene_act].time_sum_normal = 1;
         scenes[scene_act].fps_normal = (1000 * scenes[scene_act].refr_cnt_normal) / scenes[scene_act].time_sum_normal;
+        if(scenes[scene_act].refr_cnt_normal) {
+            scenes[scene_act].layout_us_normal = scenes[scene_act].layout_sum_normal / scenes[scene_act].refr_cnt_normal;
+        }
         opa_mode = true;
     }
 
-    if(scenes[scene_act].create_cb) {
+    if(scene_act < (int32_t)scene_end) {
         lv_label_set_text_fmt(title, "%d/%d: %s%s", scene_act * 2 + (opa_mode ? 1 : 0), (sizeof(scenes) / sizeof(scene_dsc_t) * 2) - 2,  scenes[scene_act].name, opa_mode ? " + opa" : "");
+        if(rotation_mode) {
+            static const char * rot_txt[ROT_NUM] = {" (0 deg)", " (90 deg)", " (180 deg)", " (270 deg)"};
+            lv_label_ins_text(title, LV_LABEL_POS_LAST, rot_txt[rot_act]);
+        }
         if(opa_mode) {
-            lv_label_set_text_fmt(subtitle, "Result of \"%s\": %d FPS", scenes[scene_act].name, scenes[scene_act].fps_normal);
+            if(scenes[scene_act].layout_us_normal) {
+                lv_label_set_text_fmt(subtitle, "Result of \"%s\": %d FPS, layout: %d us", scenes[scene_act].name,
+                                      scenes[scene_act].fps_normal, scenes[scene_act].layout_us_normal);
+            } else {
+                lv_label_set_text_fmt(subtitle, "Result of \"%s\": %d FPS", scenes[scene_act].name, scenes[scene_act].fps_normal);
+            }
         } else {
-            if(scene_act > 0) {
-                lv_label_set_text_fmt(subtitle, "Result of \"%s + opa\": %d FPS", scenes[scene_act - 1].name, scenes[scene_act - 1].fps_opa);
+            if(scene_act > (int32_t)scene_first) {
+                if(scenes[scene_act - 1].layout_us_opa) {
+                    lv_label_set_text_fmt(subtitle, "Result of \"%s + opa\": %d FPS, layout: %d us", scenes[scene_act - 1].name,
+                                          scenes[scene_act - 1].fps_opa, scenes[scene_act - 1].layout_us_opa);
+                } else {
+                    lv_label_set_text_fmt(subtitle, "Result of \"%s + opa\": %d FPS", scenes[scene_act - 1].name, scenes[scene_act - 1].fps_opa);
+                }
             } else {
                 lv_label_set_text(subtitle, "");
             }
@@ -709,6 +994,16 @@ static void scene_next_task_cb(lv_timer_t * timer)
         lv_timer_set_repeat_count(t, 1);
 
     }
+    /*Run the scenes again with the next rotation*/
+    else if(rotation_mode && rot_act < LV_DISP_ROT_270) {
+        rot_act++;
+        lv_disp_set_rotation(lv_disp_get_next(NULL), rot_act);
+        scene_bg_refr_size();
+
+        scene_act = -1;
+        opa_mode = true;
+        scene_next_task_cb(NULL);
+    }
     /*Ready*/
     else {
         uint32_t weight_sum = 0;
@@ -718,7 +1013,7 @@ static void scene_next_task_cb(lv_timer_t * timer)
         uint32_t fps_normal_sum = 0;
         uint32_t fps_opa_sum = 0;
         uint32_t i;
-        for(i = 0; scenes[i].create_cb; i++) {
+        for(i = scene_first; i < scene_end; i++) {
             fps_normal_sum += scenes[i].fps_normal * scenes[i].weight;
             weight_normal_sum += scenes[i].weight;
 
@@ -783,7 +1078,7 @@ static void scene_next_task_cb(lv_timer_t * timer)
 //        lv_table_set_cell_type(table, row, 0, 4);
         row++;
         char buf[256];
-        for(i = 0; i < sizeof(scenes) / sizeof(scene_dsc_t) - 1; i++) {
+        for(i = scene_first; i < scene_end; i++) {
 
             if(scenes[i].fps_normal < 20 && scenes[i].weight >= 10) {
                 lv_table_set_cell_value(table, row, 0, scenes[i].name);
@@ -823,7 +1118,7 @@ static void scene_next_task_cb(lv_timer_t * timer)
 //        lv_table_set_cell_type(table, row, 0, 4);
         row++;
 
-        for(i = 0; i < sizeof(scenes) / sizeof(scene_dsc_t) - 1; i++) {
+        for(i = scene_first; i < scene_end; i++) {
             lv_table_set_cell_value(table, row, 0, scenes[i].name);
 
             lv_snprintf(buf, sizeof(buf), "%d", scenes[i].fps_normal);
@@ -857,13 +1152,120 @@ static void scene_next_task_cb(lv_timer_t * timer)
             }
 
             row++;
+
+            if(scenes[i].img_draw_cnt) {
+                uint32_t hit_pct = 100 - LV_MIN((scenes[i].img_open_cnt * 100) / scenes[i].img_draw_cnt, 100);
+                uint32_t open_us = scenes[i].img_open_cnt ? scenes[i].img_open_time / scenes[i].img_open_cnt : 0;
+
+                lv_snprintf(buf, sizeof(buf), "%s cache hit [%%]", scenes[i].name);
+                lv_table_set_cell_value(table, row, 0, buf);
+                lv_snprintf(buf, sizeof(buf), "%d", hit_pct);
+                lv_table_set_cell_value(table, row, 1, buf);
+                row++;
+
+                lv_snprintf(buf, sizeof(buf), "%s decode [us]", scenes[i].name);
+                lv_table_set_cell_value(table, row, 0, buf);
+                lv_snprintf(buf, sizeof(buf), "%d", open_us);
+                lv_table_set_cell_value(table, row, 1, buf);
+                row++;
+
+                LV_LOG_USER("%s: %d FPS, cache hit: %d%%, decode: %d us", scenes[i].name, scenes[i].fps_normal, hit_pct, open_us);
+            }
+
+            if(scenes[i].font_cache) {
+                lv_demo_font_cache_t * fc = scenes[i].font_cache;
+                uint32_t lookup_cnt = LV_MAX(fc->hit_cnt + fc->miss_cnt, 1);
+
+                lv_snprintf(buf, sizeof(buf), "%s hit [%%]", scenes[i].name);
+                lv_table_set_cell_value(table, row, 0, buf);
+                lv_snprintf(buf, sizeof(buf), "%d", (fc->hit_cnt * 100) / lookup_cnt);
+                lv_table_set_cell_value(table, row, 1, buf);
+                row++;
+
+                LV_LOG_USER("%s: %d hits, %d misses", scenes[i].name, fc->hit_cnt, fc->miss_cnt);
+            }
+
+            /*The text layout is measured separately, so show it as its own cost*/
+            if(scenes[i].layout_us_normal || scenes[i].layout_us_opa) {
+                lv_snprintf(buf, sizeof(buf), "%s layout [us]", scenes[i].name);
+                lv_table_set_cell_value(table, row, 0, buf);
+
+                lv_snprintf(buf, sizeof(buf), "%d", scenes[i].layout_us_normal);
+                lv_table_set_cell_value(table, row, 1, buf);
+                row++;
+
+                lv_snprintf(buf, sizeof(buf), "%s + opa layout [us]", scenes[i].name);
+                lv_table_set_cell_value(table, row, 0, buf);
+
+                lv_snprintf(buf, sizeof(buf), "%d", scenes[i].layout_us_opa);
+                lv_table_set_cell_value(table, row, 1, buf);
+                row++;
+            }
+        }
+
+        if(rotation_mode) {
+            rotation_result_add(table, row);
+            rotation_mode = false;
+            rot_act = LV_DISP_ROT_NONE;
+            lv_disp_set_rotation(lv_disp_get_next(NULL), LV_DISP_ROT_NONE);
         }
 
 //        lv_page_set_scrl_layout(page, LV_LAYOUT_COLUMN_LEFT);
 
+        if(finished_cb) finished_cb();
+
     }
 }
 
+static void scene_bg_refr_size(void)
+{
+    lv_obj_t * scr = lv_scr_act();
+    lv_obj_update_layout(scr);
+    lv_obj_set_size(scene_bg, lv_obj_get_width(scr), lv_obj_get_height(scr) - subtitle->coords.y2 - LV_DPI_DEF / 30);
+    lv_obj_align(scene_bg, LV_ALIGN_BOTTOM_MID, 0, 0);
+}
+
+/**
+ * Add the extra cost of the software rotation compared to the not rotated case to the summary table.
+ * @param table     the summary table
+ * @param row       the first free row
+ */
+static void rotation_result_add(lv_obj_t * table, uint16_t row)
+{
+    static const char * rot_names[ROT_NUM] = {"0 deg", "90 deg", "180 deg", "270 deg"};
+
+    lv_table_add_cell_ctrl(table, row, 0, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
+    lv_table_set_cell_value(table, row, 0, "Rotation [+us/frame, +ns/px]");
+    row++;
+
+    char buf[256];
+    uint32_t i;
+    for(i = 0; i < sizeof(scenes) / sizeof(scene_dsc_t) - 1; i++) {
+        scene_dsc_t * s = &scenes[i];
+        if(s->rot_refr_cnt[0] == 0 || s->rot_px_sum[0] == 0) continue;
+
+        /*Use 64 bit to not overflow with ns*/
+        int32_t us_frame_ref = (int32_t)(((uint64_t)s->rot_time_sum[0] * 1000) / s->rot_refr_cnt[0]);
+        int32_t ns_px_ref = (int32_t)(((uint64_t)s->rot_time_sum[0] * 1000000) / s->rot_px_sum[0]);
+
+        uint32_t r;
+        for(r = LV_DISP_ROT_90; r < ROT_NUM; r++) {
+            if(s->rot_refr_cnt[r] == 0 || s->rot_px_sum[r] == 0) continue;
+            int32_t us_frame = (int32_t)(((uint64_t)s->rot_time_sum[r] * 1000) / s->rot_refr_cnt[r]);
+            int32_t ns_px = (int32_t)(((uint64_t)s->rot_time_sum[r] * 1000000) / s->rot_px_sum[r]);
+
+            lv_snprintf(buf, sizeof(buf), "%s, %s", s->name, rot_names[r]);
+            lv_table_set_cell_value(table, row, 0, buf);
+
+            lv_snprintf(buf, sizeof(buf), "%d, %d", us_frame - us_frame_ref, ns_px - ns_px_ref);
+            lv_table_set_cell_value(table, row, 1, buf);
+
+            LV_LOG_USER("Rotation of \"%s\" with %s: %d us/frame, %d ns/px extra", s->name, rot_names[r],
+                        us_frame - us_frame_ref, ns_px - ns_px_ref);
+            row++;
+        }
+    }
+}
 
 static void rect_create(lv_style_t * style)
 {
@@ -901,6 +1303,80 @@ static void img_create(lv_style_t * style, const void * src, bool rotate, bool z
     }
 }
 
+static lv_res_t cnt_decoder_info(lv_img_decoder_t * decoder, const void * src, lv_img_header_t * header)
+{
+    return lv_img_decoder_built_in_info(decoder, src, header);
+}
+
+static lv_res_t cnt_decoder_open(lv_img_decoder_t * decoder, lv_img_decoder_dsc_t * dsc)
+{
+    /*The decoder is opened only if the image is not found in the cache*/
+    uint32_t t = _lv_demo_benchmark_clock();
+    lv_res_t res = lv_img_decoder_built_in_open(decoder, dsc);
+    if(scene_act < (int32_t)scene_first || scene_act >= (int32_t)scene_end) return res;
+
+    scenes[scene_act].img_open_time += _lv_demo_benchmark_clock() - t;
+    scenes[scene_act].img_open_cnt++;
+    return res;
+}
+
+static void img_draw_cnt_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    if(scene_act < (int32_t)scene_first || scene_act >= (int32_t)scene_end) return;
+
+    scenes[scene_act].img_draw_cnt++;
+}
+
+/**
+ * Create more images with different sources than the image cache can hold
+ * @param style     style to add to the images
+ * @param base      the images will be copies of this image (if `path_fmt == NULL`)
+ * @param path_fmt  printf format to get the path of the files with `%d` = 0...IMG_CACHE_SRC_MAX - 1
+ * @param factor    the number of different sources is `factor` times the cache size
+ */
+static void img_cache_create(lv_style_t * style, const lv_img_dsc_t * base, const char * path_fmt, uint32_t factor)
+{
+    /*Wrap the built-in decoder to count the cache misses and to measure the decoding time.
+     *It's deleted when the scene ends.*/
+    if(cnt_decoder == NULL) {
+        cnt_decoder = lv_img_decoder_create();
+        lv_img_decoder_set_info_cb(cnt_decoder, cnt_decoder_info);
+        lv_img_decoder_set_open_cb(cnt_decoder, cnt_decoder_open);
+        lv_img_decoder_set_read_line_cb(cnt_decoder, lv_img_decoder_built_in_read_line);
+        lv_img_decoder_set_close_cb(cnt_decoder, lv_img_decoder_built_in_close);
+    }
+
+    /*Start with an empty cache*/
+    lv_img_cache_invalidate_src(NULL);
+
+    uint32_t src_num = LV_MIN(IMG_CACHE_SIZE * factor, IMG_CACHE_SRC_MAX);
+    uint32_t i;
+    for(i = 0; i < src_num; i++) {
+        const void * src;
+#ifdef LV_DEMO_BENCHMARK_IMG_CACHE_FILE_FMT
+        if(path_fmt) {
+            lv_snprintf(img_cache_paths[i], sizeof(img_cache_paths[i]), path_fmt, i);
+            src = img_cache_paths[i];
+        } else
+#else
+        LV_UNUSED(path_fmt);
+#endif
+        {
+            /*The cache identifies the variables by their address so the copies are different images*/
+            img_cache_dscs[i] = *base;
+            src = &img_cache_dscs[i];
+        }
+
+        lv_obj_t * obj = lv_img_create(scene_bg);
+        lv_obj_remove_style_all(obj);
+        lv_obj_add_style(obj, style, 0);
+        lv_img_set_src(obj, src);
+        lv_obj_add_event_cb(obj, img_draw_cnt_event_cb, LV_EVENT_DRAW_MAIN_BEGIN, NULL);
+
+        fall_anim(obj);
+    }
+}
 
 static void txt_create(lv_style_t * style)
 {
@@ -917,6 +1393,65 @@ static void txt_create(lv_style_t * style)
     }
 }
 
+/**
+ * Get the cached version of a font. The cache is emptied to start all scenes with the same state.
+ * @param cache     a glyph cache
+ * @param base      the font to cache
+ * @return          the font to use
+ */
+static const lv_font_t * font_cache_get(lv_demo_font_cache_t * cache, const lv_font_t * base)
+{
+    if(cache->base == NULL) lv_demo_font_cache_init(cache, base, LV_DEMO_BENCHMARK_GLYPH_CACHE_SIZE);
+    else lv_demo_font_cache_clear(cache);
+
+    return &cache->font;
+}
+
+static const char * txt_long_get(void)
+{
+    if(txt_long[0] == '\0') {
+        uint32_t i;
+        for(i = 0; i < TXT_LONG_REPEAT; i++) {
+            lv_memcpy(&txt_long[i * (sizeof(TXT_LONG_PARAGRAPH) - 1)], TXT_LONG_PARAGRAPH, sizeof(TXT_LONG_PARAGRAPH));
+        }
+    }
+
+    return txt_long;
+}
+
+static void txt_long_create(lv_style_t * style, lv_label_long_mode_t long_mode)
+{
+    uint32_t i;
+    for(i = 0; i < TXT_LONG_OBJ_NUM; i++) {
+        lv_obj_t * obj = lv_label_create(scene_bg);
+        lv_obj_remove_style_all(obj);
+        lv_obj_add_style(obj, style, 0);
+        lv_obj_set_style_text_color(obj, lv_color_hex(rnd_next(0, 0xFFFFF0)), 0);
+        lv_label_set_long_mode(obj, long_mode);
+        lv_label_set_text(obj, txt_long_get());     /*Not static because the dot mode modifies the text*/
+
+        /*The wrapped label grows with the text, the others have a fixed viewport*/
+        if(long_mode != LV_LABEL_LONG_WRAP) lv_obj_set_height(obj, lv_obj_get_height(scene_bg) / 2);
+        lv_obj_set_pos(obj, (lv_obj_get_width(scene_bg) / 2) * (i % 2), (lv_obj_get_height(scene_bg) / 2) * (i / 2));
+
+        reflow_anim(obj);
+    }
+}
+
+static void textarea_long_create(lv_style_t * style)
+{
+    uint32_t i;
+    for(i = 0; i < TXT_LONG_OBJ_NUM; i++) {
+        lv_obj_t * obj = lv_textarea_create(scene_bg);
+        lv_obj_add_style(obj, style, 0);
+        lv_obj_set_style_text_color(obj, lv_color_hex(rnd_next(0, 0xFFFFF0)), 0);
+        lv_textarea_set_text(obj, txt_long_get());
+        lv_obj_set_height(obj, lv_obj_get_height(scene_bg) / 2);
+        lv_obj_set_pos(obj, (lv_obj_get_width(scene_bg) / 2) * (i % 2), (lv_obj_get_height(scene_bg) / 2) * (i / 2));
+
+        reflow_anim(obj);
+    }
+}
 
 static void line_create(lv_style_t * style)
 {
@@ -994,6 +1529,40 @@ static void fall_anim(lv_obj_t * obj)
 
 }
 
+static void reflow_exec_cb(void * var, int32_t v)
+{
+    /*Measure the reflow on the width change: the line breaking for the new size of the label
+     *and of the text area's scrollable content. It's not taken out of the monitor's time:
+     *`lv_draw_label()` breaks the lines of the visible part again while drawing.*/
+    uint32_t t = _lv_demo_benchmark_clock();
+    lv_obj_set_width(var, v);
+    lv_obj_update_layout(var);
+    t = _lv_demo_benchmark_clock() - t;
+
+    if(rot_act != LV_DISP_ROT_NONE) return;     /*Like the render times, count only the unrotated passes*/
+    if(opa_mode) scenes[scene_act].layout_sum_opa += t;
+    else scenes[scene_act].layout_sum_normal += t;
+}
+
+/**
+ * Change the width of an object on every frame to force its text to be reflowed
+ * @param obj   a label or text area
+ */
+static void reflow_anim(lv_obj_t * obj)
+{
+    uint32_t t = rnd_next(ANIM_TIME_MIN, ANIM_TIME_MAX);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_exec_cb(&a, reflow_exec_cb);
+    lv_anim_set_values(&a, TXT_LONG_WIDTH_MIN, TXT_LONG_WIDTH_MAX);
+    lv_anim_set_time(&a, t);
+    lv_anim_set_playback_time(&a, t);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_start(&a);
+}
+
 static void rnd_reset(void)
 {
     rnd_act = 0;
@@ -21,12 +21,93 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
+typedef void (*lv_demo_benchmark_finished_cb_t)(void);
+
+/*Return a time in microseconds. Only the difference of two calls is used so it can overflow.*/
+typedef uint32_t (*lv_demo_benchmark_clock_cb_t)(void);
+
+typedef struct {
+    const char * name;
+    uint32_t fps_normal;
+    uint32_t fps_opa;
+    uint32_t time_sum_normal;   /*Sum of the render times [ms]*/
+    uint32_t time_sum_opa;
+    uint32_t refr_cnt_normal;   /*Number of refreshes*/
+    uint32_t refr_cnt_opa;
+    uint8_t weight;
+} lv_demo_benchmark_result_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 void lv_demo_benchmark(void);
 
+/**
+ * Measure the draw functions (rectangle, image, label, line, arc, polygon) directly
+ * in a tight loop into an off-screen buffer and show the ns/call and ns/px results.
+ */
+void lv_demo_benchmark_draw(void);
+
+/**
+ * Run all the scenes with 0, 90, 180 and 270 degree software rotation
+ * and add the extra cost of the rotation to the summary.
+ */
+void lv_demo_benchmark_rotation(void);
+
+/**
+ * Set a callback to call when all the scenes are ready and the summary is shown
+ * @param finished_cb   pointer to a callback or NULL
+ */
+void lv_demo_benchmark_set_finished_cb(lv_demo_benchmark_finished_cb_t finished_cb);
+
+/**
+ * Set a more precise clock to measure the reflow of the long texts ("layout"), the image decoding ("decode")
+ * and the cases of `lv_demo_benchmark_draw()`.
+ * By default `lv_tick_get()` is used which has only millisecond resolution, too coarse for a single reflow or decode.
+ * @param clock_cb      pointer to a callback or NULL to use `lv_tick_get()`
+ */
+void lv_demo_benchmark_set_clock_cb(lv_demo_benchmark_clock_cb_t clock_cb);
+
+/**
+ * Run only a part of the scenes. Should be called before `lv_demo_benchmark()`.
+ * Useful to run the scenes parallel in more processes.
+ * @param first     index of the first scene to run
+ * @param end       index after the last scene to run
+ * @return          false: invalid range
+ */
+bool lv_demo_benchmark_set_scene_range(uint32_t first, uint32_t end);
+
+/**
+ * Create only one scene without measuring it and without going to the next scene.
+ * Can be called instead of `lv_demo_benchmark()`, e.g. to check the rendered image of the scenes.
+ * @param id    index of the scene (`0 ... lv_demo_benchmark_get_scene_cnt() - 1`)
+ * @param opa   true: create the scene in opa mode
+ * @return      false: invalid `id`
+ */
+bool lv_demo_benchmark_load_scene(uint32_t id, bool opa);
+
+/**
+ * Get the number of scenes
+ * @return      the number of scenes
+ */
+uint32_t lv_demo_benchmark_get_scene_cnt(void);
+
+/**
+ * Get the index of the running scene. Can be used to assign external measurements to the scenes.
+ * @return      index of the scene, -1 before the first scene, the end of the scene range after the last one
+ */
+int32_t lv_demo_benchmark_get_scene_act(void);
+
+/**
+ * Get the result of a scene. Can be used when the benchmark is finished.
+ * @param id    index of the scene (`0 ... lv_demo_benchmark_get_scene_cnt() - 1`)
+ * @param res   store the result here
+ * @return      false: invalid `id`
+ */
+bool lv_demo_benchmark_get_result(uint32_t id, lv_demo_benchmark_result_t * res);
+
+uint32_t _lv_demo_benchmark_clock(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,377 @@
+/**
+ * @file lv_demo_benchmark_draw.c
+ * Measure the draw functions directly, without objects, invalidation and animations.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_demo.h"
+#include "lv_demo_benchmark.h"
+
+#if LV_USE_DEMO_BENCHMARK
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BUF_W           160
+#define BUF_H           120
+#define SIZE_SMALL      20
+#define CASE_TIME       200000  /*us*/
+#define CALL_MAX        100000  /*Stop earlier if the clock is not running during the test*/
+#define BATCH           8       /*Number of calls between reading the clock*/
+#define VARIANT_NUM     4       /*small/large x cover/opa*/
+#define TXT             "hello world\nit is a multi line text to test\nthe performance of text rendering"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef union {
+    lv_draw_rect_dsc_t rect;
+    lv_draw_img_dsc_t img;
+    lv_draw_label_dsc_t label;
+    lv_draw_line_dsc_t line;
+    lv_draw_arc_dsc_t arc;
+} draw_dsc_t;
+
+typedef struct {
+    const char * name;
+    void (*init_cb)(draw_dsc_t * dsc, lv_opa_t opa);
+    void (*draw_cb)(const lv_area_t * coords, const lv_area_t * clip, const draw_dsc_t * dsc);
+    const void * img_src;       /*For the image cases: `coords` will be the image's area*/
+    uint32_t ns_call[VARIANT_NUM];
+    uint32_t ns_px_x100[VARIANT_NUM];
+} draw_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void next_case_cb(lv_timer_t * timer);
+static void run_case(draw_case_t * dc, uint32_t variant);
+static void show_result(void);
+static bool fake_disp_init(void);
+
+LV_IMG_DECLARE(img_benchmark_cogwheel_rgb);
+LV_IMG_DECLARE(img_benchmark_cogwheel_argb);
+
+static void rect_init(draw_dsc_t * dsc, lv_opa_t opa)
+{
+    lv_draw_rect_dsc_init(&dsc->rect);
+    dsc->rect.bg_color = lv_palette_main(LV_PALETTE_BLUE);
+    dsc->rect.bg_opa = opa;
+}
+
+static void rect_rounded_init(draw_dsc_t * dsc, lv_opa_t opa)
+{
+    rect_init(dsc, opa);
+    dsc->rect.radius = LV_MAX(LV_DPI_DEF / 15, 2);
+}
+
+static void border_init(draw_dsc_t * dsc, lv_opa_t opa)
+{
+    lv_draw_rect_dsc_init(&dsc->rect);
+    dsc->rect.bg_opa = LV_OPA_TRANSP;
+    dsc->rect.radius = LV_MAX(LV_DPI_DEF / 15, 2);
+    dsc->rect.border_color = lv_palette_main(LV_PALETTE_RED);
+    dsc->rect.border_width = LV_MAX(LV_DPI_DEF / 40, 1);
+    dsc->rect.border_opa = opa;
+}
+
+static void shadow_init(draw_dsc_t * dsc, lv_opa_t opa)
+{
+    rect_rounded_init(dsc, LV_OPA_COVER);
+    dsc->rect.shadow_color = lv_palette_main(LV_PALETTE_GREY);
+    dsc->rect.shadow_width = LV_MAX(LV_DPI_DEF / 15, 5);
+    dsc->rect.shadow_opa = opa;
+}
+
+static void rect_draw(const lv_area_t * coords, const lv_area_t * clip, const draw_dsc_t * dsc)
+{
+    lv_draw_rect(coords, clip, &dsc->rect);
+}
+
+static void img_init(draw_dsc_t * dsc, lv_opa_t opa)
+{
+    lv_draw_img_dsc_init(&dsc->img);
+    dsc->img.opa = opa;
+}
+
+static void img_rotate_init(draw_dsc_t * dsc, lv_opa_t opa)
+{
+    img_init(dsc, opa);
+    dsc->img.angle = 300;
+    dsc->img.antialias = 1;
+}
+
+static void img_rgb_draw(const lv_area_t * coords, const lv_area_t * clip, const draw_dsc_t * dsc)
+{
+    lv_draw_img(coords, clip, &img_benchmark_cogwheel_rgb, &dsc->img);
+}
+
+static void img_argb_draw(const lv_area_t * coords, const lv_area_t * clip, const draw_dsc_t * dsc)
+{
+    lv_draw_img(coords, clip, &img_benchmark_cogwheel_argb, &dsc->img);
+}
+
+static void label_init(draw_dsc_t * dsc, lv_opa_t opa)
+{
+    lv_draw_label_dsc_init(&dsc->label);
+    dsc->label.font = LV_FONT_DEFAULT;
+    dsc->label.opa = opa;
+}
+
+static void label_draw(const lv_area_t * coords, const lv_area_t * clip, const draw_dsc_t * dsc)
+{
+    lv_draw_label(coords, clip, &dsc->label, TXT, NULL);
+}
+
+static void line_init(draw_dsc_t * dsc, lv_opa_t opa)
+{
+    lv_draw_line_dsc_init(&dsc->line);
+    dsc->line.color = lv_palette_main(LV_PALETTE_GREEN);
+    dsc->line.width = LV_MAX(LV_DPI_DEF / 50, 2);
+    dsc->line.opa = opa;
+}
+
+static void line_draw(const lv_area_t * coords, const lv_area_t * clip, const draw_dsc_t * dsc)
+{
+    lv_point_t p1 = {coords->x1, coords->y1};
+    lv_point_t p2 = {coords->x2, coords->y2};
+    lv_draw_line(&p1, &p2, clip, &dsc->line);
+}
+
+static void arc_init(draw_dsc_t * dsc, lv_opa_t opa)
+{
+    lv_draw_arc_dsc_init(&dsc->arc);
+    dsc->arc.color = lv_palette_main(LV_PALETTE_ORANGE);
+    dsc->arc.width = LV_MAX(LV_DPI_DEF / 10, 5);
+    dsc->arc.opa = opa;
+}
+
+static void arc_draw(const lv_area_t * coords, const lv_area_t * clip, const draw_dsc_t * dsc)
+{
+    lv_coord_t r = LV_MIN(lv_area_get_width(coords), lv_area_get_height(coords)) / 2;
+    lv_draw_arc(coords->x1 + r, coords->y1 + r, r, 0, 270, clip, &dsc->arc);
+}
+
+static void polygon_draw(const lv_area_t * coords, const lv_area_t * clip, const draw_dsc_t * dsc)
+{
+    lv_coord_t w = lv_area_get_width(coords);
+    lv_coord_t h = lv_area_get_height(coords);
+    lv_point_t points[] = {
+        {coords->x1 + w / 2, coords->y1},
+        {coords->x2, coords->y1 + (h * 2) / 5},
+        {coords->x1 + (w * 4) / 5, coords->y2},
+        {coords->x1 + w / 5, coords->y2},
+        {coords->x1, coords->y1 + (h * 2) / 5},
+    };
+    lv_draw_polygon(points, sizeof(points) / sizeof(points[0]), clip, &dsc->rect);
+}
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static draw_case_t cases[] = {
+        {.name = "Rectangle",         .init_cb = rect_init,         .draw_cb = rect_draw},
+        {.name = "Rectangle rounded", .init_cb = rect_rounded_init, .draw_cb = rect_draw},
+        {.name = "Border",            .init_cb = border_init,       .draw_cb = rect_draw},
+        {.name = "Shadow",            .init_cb = shadow_init,       .draw_cb = rect_draw},
+        {.name = "Image RGB",         .init_cb = img_init,          .draw_cb = img_rgb_draw, .img_src = &img_benchmark_cogwheel_rgb},
+        {.name = "Image ARGB",        .init_cb = img_init,          .draw_cb = img_argb_draw, .img_src = &img_benchmark_cogwheel_argb},
+        {.name = "Image ARGB rotate", .init_cb = img_rotate_init,   .draw_cb = img_argb_draw, .img_src = &img_benchmark_cogwheel_argb},
+        {.name = "Text",              .init_cb = label_init,        .draw_cb = label_draw},
+        {.name = "Line",              .init_cb = line_init,         .draw_cb = line_draw},
+        {.name = "Arc",               .init_cb = arc_init,          .draw_cb = arc_draw},
+        {.name = "Polygon",           .init_cb = rect_init,         .draw_cb = polygon_draw},
+
+        {.name = "", .draw_cb = NULL}
+};
+
+static const char * variant_names[VARIANT_NUM] = {"small", "small + opa", "large", "large + opa"};
+
+static lv_disp_t fake_disp;
+static lv_disp_drv_t fake_drv;
+static lv_disp_draw_buf_t fake_draw_buf;
+static lv_color_t * fake_buf;
+
+static uint32_t case_act;
+static uint32_t variant_act;
+static lv_obj_t * title;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_demo_benchmark_draw(void)
+{
+    lv_obj_t * scr = lv_scr_act();
+    lv_obj_clean(scr);
+
+    title = lv_label_create(scr);
+    lv_obj_set_pos(title, LV_DPI_DEF / 30, LV_DPI_DEF / 30);
+
+    if(!fake_disp_init()) {
+        lv_label_set_text(title, "Not enough memory for the draw buffer");
+        LV_LOG_WARN("couldn't allocate the %dx%d draw buffer", BUF_W, BUF_H);
+        return;
+    }
+
+    case_act = 0;
+    variant_act = 0;
+
+    /*Run only one case in a timer call to let the screen show the progress*/
+    lv_timer_create(next_case_cb, 10, NULL);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void next_case_cb(lv_timer_t * timer)
+{
+    if(cases[case_act].draw_cb == NULL) {
+        lv_timer_del(timer);
+        lv_mem_free(fake_buf);
+        fake_buf = NULL;
+        show_result();
+        return;
+    }
+
+    run_case(&cases[case_act], variant_act);
+
+    lv_label_set_text_fmt(title, "%s, %s: %d ns/call", cases[case_act].name, variant_names[variant_act],
+                          cases[case_act].ns_call[variant_act]);
+
+    LV_LOG_USER("%s, %s: %d ns/call, %d.%02d ns/px", cases[case_act].name, variant_names[variant_act],
+                cases[case_act].ns_call[variant_act],
+                cases[case_act].ns_px_x100[variant_act] / 100, cases[case_act].ns_px_x100[variant_act] % 100);
+
+    variant_act++;
+    if(variant_act >= VARIANT_NUM) {
+        variant_act = 0;
+        case_act++;
+    }
+}
+
+/**
+ * Call a draw function in a tight loop into the off-screen buffer
+ * @param dc        the case to measure
+ * @param variant   0: small, 1: small + opa, 2: large, 3: large + opa
+ */
+static void run_case(draw_case_t * dc, uint32_t variant)
+{
+    bool large = variant >= 2;
+    lv_opa_t opa = (variant & 1) ? LV_OPA_50 : LV_OPA_COVER;
+
+    lv_area_t clip;
+    lv_area_set(&clip, 0, 0, (large ? BUF_W : SIZE_SMALL) - 1, (large ? BUF_H : SIZE_SMALL) - 1);
+
+    /*Images are drawn in their original size and the clip area selects the drawn part*/
+    lv_area_t coords;
+    if(dc->img_src) {
+        const lv_img_dsc_t * img = dc->img_src;
+        lv_area_set(&coords, 0, 0, img->header.w - 1, img->header.h - 1);
+    } else {
+        lv_area_copy(&coords, &clip);
+    }
+
+    lv_area_t px_area;
+    if(!_lv_area_intersect(&px_area, &coords, &clip)) return;
+    uint32_t px_per_call = lv_area_get_size(&px_area);
+
+    draw_dsc_t dsc;
+    dc->init_cb(&dsc, opa);
+
+    lv_disp_t * refr_ori = _lv_refr_get_disp_refreshing();
+    _lv_refr_set_disp_refreshing(&fake_disp);
+
+    /*Warm up the caches (e.g. image cache, shadow cache)*/
+    dc->draw_cb(&coords, &clip, &dsc);
+
+    uint32_t call_cnt = 0;
+    uint32_t elaps = 0;
+    uint32_t t = _lv_demo_benchmark_clock();
+    while(elaps < CASE_TIME && call_cnt < CALL_MAX) {
+        uint32_t i;
+        for(i = 0; i < BATCH; i++) {
+            dc->draw_cb(&coords, &clip, &dsc);
+        }
+        call_cnt += BATCH;
+        elaps = _lv_demo_benchmark_clock() - t;
+    }
+
+    _lv_refr_set_disp_refreshing(refr_ori);
+
+    uint64_t ns = (uint64_t)elaps * 1000;
+    dc->ns_call[variant] = (uint32_t)(ns / call_cnt);
+    dc->ns_px_x100[variant] = (uint32_t)((ns * 100) / ((uint64_t)call_cnt * px_per_call));
+}
+
+static void show_result(void)
+{
+    lv_obj_t * scr = lv_scr_act();
+    lv_obj_clean(scr);
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_COLUMN);
+
+    title = lv_label_create(scr);
+    lv_label_set_text_fmt(title, "Draw functions, %dx%d px buffer", BUF_W, BUF_H);
+
+    lv_coord_t w = lv_obj_get_content_width(scr);
+    lv_obj_t * table = lv_table_create(scr);
+    lv_table_set_col_cnt(table, 3);
+    lv_table_set_col_width(table, 0, w / 2 - 3);
+    lv_table_set_col_width(table, 1, w / 4 - 3);
+    lv_table_set_col_width(table, 2, w / 4 - 3);
+    lv_obj_set_width(table, lv_pct(100));
+
+    lv_table_set_cell_value(table, 0, 0, "Case");
+    lv_table_set_cell_value(table, 0, 1, "ns/call");
+    lv_table_set_cell_value(table, 0, 2, "ns/px");
+
+    uint16_t row = 1;
+    char buf[64];
+    uint32_t i;
+    for(i = 0; cases[i].draw_cb; i++) {
+        uint32_t v;
+        for(v = 0; v < VARIANT_NUM; v++) {
+            lv_snprintf(buf, sizeof(buf), "%s, %s", cases[i].name, variant_names[v]);
+            lv_table_set_cell_value(table, row, 0, buf);
+
+            lv_snprintf(buf, sizeof(buf), "%d", cases[i].ns_call[v]);
+            lv_table_set_cell_value(table, row, 1, buf);
+
+            lv_snprintf(buf, sizeof(buf), "%d.%02d", cases[i].ns_px_x100[v] / 100, cases[i].ns_px_x100[v] % 100);
+            lv_table_set_cell_value(table, row, 2, buf);
+            row++;
+        }
+    }
+}
+
+/**
+ * Create a display which is never registered, only to let the draw functions render into `fake_buf`.
+ * Similar to how the canvas draws.
+ * @return true: the buffer is allocated
+ */
+static bool fake_disp_init(void)
+{
+    fake_buf = lv_mem_alloc(BUF_W * BUF_H * sizeof(lv_color_t));
+    if(fake_buf == NULL) return false;
+
+    lv_memset_00(&fake_disp, sizeof(lv_disp_t));
+    lv_disp_drv_init(&fake_drv);
+    fake_drv.hor_res = BUF_W;
+    fake_drv.ver_res = BUF_H;
+
+    lv_disp_draw_buf_init(&fake_draw_buf, fake_buf, NULL, BUF_W * BUF_H);
+    lv_area_set(&fake_draw_buf.area, 0, 0, BUF_W - 1, BUF_H - 1);
+    fake_drv.draw_buf = &fake_draw_buf;
+    fake_disp.driver = &fake_drv;
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,128 @@
+/**
+ * @file lv_demo_font_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_demo_font_cache.h"
+
+#if LV_USE_DEMO_BENCHMARK
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t letter;
+    uint32_t size;
+    uint8_t * bitmap;
+} glyph_entry_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static const uint8_t * get_glyph_bitmap_cached(const lv_font_t * font, uint32_t letter);
+static void drop_tail(lv_demo_font_cache_t * cache);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_demo_font_cache_init(lv_demo_font_cache_t * cache, const lv_font_t * base, uint32_t size_limit)
+{
+    lv_memset_00(cache, sizeof(lv_demo_font_cache_t));
+
+    /*Use the same glyph descriptors and data, only the bitmaps go through the cache*/
+    cache->font = *base;
+    cache->font.get_glyph_bitmap = get_glyph_bitmap_cached;
+
+    cache->base = base;
+    cache->size_limit = size_limit;
+    _lv_ll_init(&cache->entries, sizeof(glyph_entry_t));
+}
+
+void lv_demo_font_cache_clear(lv_demo_font_cache_t * cache)
+{
+    while(_lv_ll_get_tail(&cache->entries)) {
+        drop_tail(cache);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static const uint8_t * get_glyph_bitmap_cached(const lv_font_t * font, uint32_t letter)
+{
+    lv_demo_font_cache_t * cache = (lv_demo_font_cache_t *)font;
+
+    glyph_entry_t * e;
+    _LV_LL_READ(&cache->entries, e) {
+        if(e->letter == letter) {
+            cache->hit_cnt++;
+            glyph_entry_t * head = _lv_ll_get_head(&cache->entries);
+            if(e != head) _lv_ll_move_before(&cache->entries, e, head);
+            return e->bitmap;
+        }
+    }
+
+    cache->miss_cnt++;
+
+    const uint8_t * bitmap = cache->base->get_glyph_bitmap(cache->base, letter);
+    if(bitmap == NULL) return NULL;
+
+    lv_font_glyph_dsc_t dsc;
+    if(!cache->base->get_glyph_dsc(cache->base, &dsc, letter, 0)) return bitmap;
+
+    /*3 bpp glyphs are decompressed to 4 bpp*/
+    uint32_t bpp = dsc.bpp == 3 ? 4 : dsc.bpp;
+    uint32_t size = ((uint32_t)dsc.box_w * dsc.box_h * bpp + 7) >> 3;
+    if(size == 0 || size > cache->size_limit) return bitmap;
+
+    while(cache->size + size > cache->size_limit) {
+        drop_tail(cache);
+    }
+
+    uint8_t * bitmap_cached = lv_mem_alloc(size);
+    if(bitmap_cached == NULL) return bitmap;
+
+    e = _lv_ll_ins_head(&cache->entries);
+    if(e == NULL) {
+        lv_mem_free(bitmap_cached);
+        return bitmap;
+    }
+
+    lv_memcpy(bitmap_cached, bitmap, size);
+    e->letter = letter;
+    e->size = size;
+    e->bitmap = bitmap_cached;
+    cache->size += size;
+
+    return bitmap_cached;
+}
+
+static void drop_tail(lv_demo_font_cache_t * cache)
+{
+    glyph_entry_t * e = _lv_ll_get_tail(&cache->entries);
+    if(e == NULL) return;
+
+    cache->size -= e->size;
+    lv_mem_free(e->bitmap);
+    _lv_ll_remove(&cache->entries, e);
+    lv_mem_free(e);
+}
+
+#endif /*LV_USE_DEMO_BENCHMARK*/
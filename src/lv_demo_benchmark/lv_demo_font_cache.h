@@ -0,0 +1,66 @@
+/**
+ * @file lv_demo_font_cache.h
+ *
+ */
+
+#ifndef LV_DEMO_FONT_CACHE_H
+#define LV_DEMO_FONT_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_demo.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A font which caches the glyph bitmaps of an other font.
+ * Useful for compressed fonts where the glyphs are decompressed on every draw.
+ */
+typedef struct {
+    lv_font_t font;             /*Use it as a normal font. Must be the first element*/
+    const lv_font_t * base;     /*The cached font*/
+    lv_ll_t entries;            /*The most recently used glyph is the head*/
+    uint32_t size;              /*Size of the cached bitmaps [bytes]*/
+    uint32_t size_limit;        /*Max. size of the cached bitmaps [bytes]*/
+    uint32_t hit_cnt;
+    uint32_t miss_cnt;
+} lv_demo_font_cache_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a glyph bitmap cache for a font. Use `&cache->font` as the font.
+ * @param cache         pointer to a cache to initialize
+ * @param base          the font whose glyph bitmaps should be cached
+ * @param size_limit    max. size of the cached bitmaps in bytes. The least recently used glyphs are dropped.
+ */
+void lv_demo_font_cache_init(lv_demo_font_cache_t * cache, const lv_font_t * base, uint32_t size_limit);
+
+/**
+ * Free all the cached glyphs. The hit and miss counters are kept.
+ * @param cache         pointer to a cache
+ */
+void lv_demo_font_cache_clear(lv_demo_font_cache_t * cache);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /*LV_DEMO_FONT_CACHE_H*/
@@ -259,7 +259,7 @@ const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_list_pause_map[] = {
 #endif
 };
 
-lv_img_dsc_t img_lv_demo_music_btn_list_pause = {
+const lv_img_dsc_t img_lv_demo_music_btn_list_pause = {
   .header.always_zero = 0,
   .header.w = 58,
   .header.h = 60,
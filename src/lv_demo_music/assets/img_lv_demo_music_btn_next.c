@@ -267,7 +267,7 @@ const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_next_map[] = {
 #endif
 };
 
-lv_img_dsc_t img_lv_demo_music_btn_next = {
+const lv_img_dsc_t img_lv_demo_music_btn_next = {
   .header.always_zero = 0,
   .header.w = 62,
   .header.h = 62,
@@ -327,7 +327,7 @@ const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_play_map[] = {
 #endif
 };
 
-lv_img_dsc_t img_lv_demo_music_btn_play = {
+const lv_img_dsc_t img_lv_demo_music_btn_play = {
   .header.always_zero = 0,
   .header.w = 79,
   .header.h = 77,
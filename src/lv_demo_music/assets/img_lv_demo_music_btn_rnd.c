@@ -115,7 +115,7 @@ const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_btn_rnd_map[] = {
 #endif
 };
 
-lv_img_dsc_t img_lv_demo_music_btn_rnd = {
+const lv_img_dsc_t img_lv_demo_music_btn_rnd = {
   .header.always_zero = 0,
   .header.w = 24,
   .header.h = 24,
@@ -91,7 +91,7 @@ const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_corner_right_map[] = {
 #endif
 };
 
-lv_img_dsc_t img_lv_demo_music_corner_right = {
+const lv_img_dsc_t img_lv_demo_music_corner_right = {
   .header.always_zero = 0,
   .header.w = 18,
   .header.h = 18,
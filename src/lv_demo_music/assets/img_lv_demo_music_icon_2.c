@@ -116,7 +116,7 @@ const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_icon_2_map[] = {
 #endif
 };
 
-lv_img_dsc_t img_lv_demo_music_icon_2 = {
+const lv_img_dsc_t img_lv_demo_music_icon_2 = {
   .header.always_zero = 0,
   .header.w = 24,
   .header.h = 24,
@@ -188,7 +188,7 @@ const LV_ATTRIBUTE_MEM_ALIGN uint8_t img_lv_demo_music_wave_top_map[] = {
 #endif
 };
 
-lv_img_dsc_t img_lv_demo_music_wave_top = {
+const lv_img_dsc_t img_lv_demo_music_wave_top = {
   .header.always_zero = 0,
   .header.w = 272,
   .header.h = 42,
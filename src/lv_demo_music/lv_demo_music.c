@@ -12,6 +12,7 @@
 
 #include "lv_demo_music_main.h"
 #include "lv_demo_music_list.h"
+#include "../assets/lv_demo_img_compr.h"
 
 /*********************
  *      DEFINES
@@ -113,6 +114,11 @@ static const uint32_t time_list[] = {
 
 void lv_demo_music(void)
 {
+#if LV_DEMO_USE_IMG_COMPR
+    /*The covers and the waves are compressed, decode them on demand*/
+    lv_demo_img_compr_init(LV_DEMO_IMG_COMPR_CACHE_SIZE);
+#endif
+
     lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(0x343247), 0);
 
     list = _lv_demo_music_list_create(lv_scr_act());
@@ -10,6 +10,7 @@
 #if LV_USE_DEMO_MUSIC
 
 #include "lv_demo_music_main.h"
+#include "../assets/lv_demo_pack.h"
 
 /*********************
  *      DEFINES
@@ -137,12 +138,12 @@ void _lv_demo_music_list_btn_check(uint32_t track_id, bool state)
 
     if(state) {
         lv_obj_add_state(btn, LV_STATE_CHECKED);
-        lv_img_set_src(icon, &img_lv_demo_music_btn_list_pause);
+        lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_btn_list_pause));
         lv_obj_scroll_to_view(btn, LV_ANIM_ON);
     }
     else {
         lv_obj_clear_state(btn, LV_STATE_CHECKED);
-        lv_img_set_src(icon, &img_lv_demo_music_btn_list_play);
+        lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_btn_list_play));
     }
 }
 
@@ -177,7 +178,7 @@ static lv_obj_t * add_list_btn(lv_obj_t * parent, uint32_t track_id)
     }
 
     lv_obj_t * icon = lv_img_create(btn);
-    lv_img_set_src(icon, &img_lv_demo_music_btn_list_play);
+    lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_btn_list_play));
     lv_obj_set_grid_cell(icon, LV_GRID_ALIGN_START, 0, 1, LV_GRID_ALIGN_CENTER, 0, 2);
 
     lv_obj_t * title_label = lv_label_create(btn);
@@ -197,7 +198,7 @@ static lv_obj_t * add_list_btn(lv_obj_t * parent, uint32_t track_id)
 
     LV_IMG_DECLARE(img_lv_demo_music_list_border);
     lv_obj_t * border = lv_img_create(btn);
-    lv_img_set_src(border, &img_lv_demo_music_list_border);
+    lv_img_set_src(border, LV_DEMO_IMG(img_lv_demo_music_list_border));
     lv_obj_set_width(border, lv_pct(120));
     lv_obj_align(border, LV_ALIGN_BOTTOM_MID, 0, 0);
     lv_obj_add_flag(border, LV_OBJ_FLAG_IGNORE_LAYOUT);
@@ -13,6 +13,7 @@
 #include "assets/spectrum_1.h"
 #include "assets/spectrum_2.h"
 #include "assets/spectrum_3.h"
+#include "../assets/lv_demo_pack.h"
 
 /*********************
  *      DEFINES
@@ -245,7 +246,7 @@ lv_obj_t * _lv_demo_music_main_create(lv_obj_t * parent)
     /* Create an intro from a logo + label */
     LV_IMG_DECLARE(img_lv_demo_music_logo);
     lv_obj_t * logo = lv_img_create(lv_scr_act());
-    lv_img_set_src(logo, &img_lv_demo_music_logo);
+    lv_img_set_src(logo, LV_DEMO_IMG(img_lv_demo_music_logo));
     lv_obj_move_foreground(logo);
 
     lv_obj_t * title = lv_label_create(lv_scr_act());
@@ -407,13 +408,13 @@ static void create_wave_images(lv_obj_t * parent)
     LV_IMG_DECLARE(img_lv_demo_music_wave_top);
     LV_IMG_DECLARE(img_lv_demo_music_wave_bottom);
     lv_obj_t * wave_top = lv_img_create(parent);
-    lv_img_set_src(wave_top,&img_lv_demo_music_wave_top);
+    lv_img_set_src(wave_top,LV_DEMO_IMG(img_lv_demo_music_wave_top));
     lv_obj_set_width(wave_top, LV_HOR_RES);
     lv_obj_align(wave_top, LV_ALIGN_TOP_MID, 0, 0);
     lv_obj_add_flag(wave_top, LV_OBJ_FLAG_IGNORE_LAYOUT);
 
     lv_obj_t * wave_bottom = lv_img_create(parent);
-    lv_img_set_src(wave_bottom,&img_lv_demo_music_wave_bottom);
+    lv_img_set_src(wave_bottom,LV_DEMO_IMG(img_lv_demo_music_wave_bottom));
     lv_obj_set_width(wave_bottom, LV_HOR_RES);
     lv_obj_align(wave_bottom, LV_ALIGN_BOTTOM_MID, 0, 0);
     lv_obj_add_flag(wave_bottom, LV_OBJ_FLAG_IGNORE_LAYOUT);
@@ -421,7 +422,7 @@ static void create_wave_images(lv_obj_t * parent)
     LV_IMG_DECLARE(img_lv_demo_music_corner_left);
     LV_IMG_DECLARE(img_lv_demo_music_corner_right);
     lv_obj_t * wave_corner = lv_img_create(parent);
-    lv_img_set_src(wave_corner, &img_lv_demo_music_corner_left);
+    lv_img_set_src(wave_corner, LV_DEMO_IMG(img_lv_demo_music_corner_left));
 #if LV_DEMO_MUSIC_ROUND == 0
     lv_obj_align(wave_corner, LV_ALIGN_BOTTOM_LEFT, 0, 0);
 #else
@@ -430,7 +431,7 @@ static void create_wave_images(lv_obj_t * parent)
     lv_obj_add_flag(wave_corner, LV_OBJ_FLAG_IGNORE_LAYOUT);
 
     wave_corner = lv_img_create(parent);
-    lv_img_set_src(wave_corner, &img_lv_demo_music_corner_right);
+    lv_img_set_src(wave_corner, LV_DEMO_IMG(img_lv_demo_music_corner_right));
 #if LV_DEMO_MUSIC_ROUND == 0
     lv_obj_align(wave_corner, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
 #else
@@ -483,13 +484,13 @@ static lv_obj_t * create_icon_box(lv_obj_t * parent)
     LV_IMG_DECLARE(img_lv_demo_music_icon_3);
     LV_IMG_DECLARE(img_lv_demo_music_icon_4);
     icon = lv_img_create(cont);
-    lv_img_set_src(icon, &img_lv_demo_music_icon_1);
+    lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_icon_1));
     icon = lv_img_create(cont);
-    lv_img_set_src(icon, &img_lv_demo_music_icon_2);
+    lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_icon_2));
     icon = lv_img_create(cont);
-    lv_img_set_src(icon, &img_lv_demo_music_icon_3);
+    lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_icon_3));
     icon = lv_img_create(cont);
-    lv_img_set_src(icon, &img_lv_demo_music_icon_4);
+    lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_icon_4));
 
     return cont;
 }
@@ -535,30 +536,30 @@ static lv_obj_t * create_ctrl_box(lv_obj_t * parent)
 
     lv_obj_t * icon;
     icon = lv_img_create(cont);
-    lv_img_set_src(icon, &img_lv_demo_music_btn_rnd);
+    lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_btn_rnd));
     lv_obj_set_grid_cell(icon, LV_GRID_ALIGN_START, 1, 1, LV_GRID_ALIGN_CENTER, 0, 1);
 
     icon = lv_img_create(cont);
-    lv_img_set_src(icon, &img_lv_demo_music_btn_loop);
+    lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_btn_loop));
     lv_obj_set_grid_cell(icon, LV_GRID_ALIGN_END, 5, 1, LV_GRID_ALIGN_CENTER, 0, 1);
 
     icon = lv_img_create(cont);
-    lv_img_set_src(icon, &img_lv_demo_music_btn_prev);
+    lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_btn_prev));
     lv_obj_set_grid_cell(icon, LV_GRID_ALIGN_CENTER, 2, 1, LV_GRID_ALIGN_CENTER, 0, 1);
     lv_obj_add_event_cb(icon, prev_click_event_cb, LV_EVENT_CLICKED, NULL);
 
     play_obj = lv_imgbtn_create(cont);
-    lv_imgbtn_set_src(play_obj, LV_IMGBTN_STATE_RELEASED, NULL, &img_lv_demo_music_btn_play, NULL);
-    lv_imgbtn_set_src(play_obj, LV_IMGBTN_STATE_CHECKED_RELEASED, NULL, &img_lv_demo_music_btn_pause, NULL);
+    lv_imgbtn_set_src(play_obj, LV_IMGBTN_STATE_RELEASED, NULL, LV_DEMO_IMG(img_lv_demo_music_btn_play), NULL);
+    lv_imgbtn_set_src(play_obj, LV_IMGBTN_STATE_CHECKED_RELEASED, NULL, LV_DEMO_IMG(img_lv_demo_music_btn_pause), NULL);
     lv_obj_add_flag(play_obj, LV_OBJ_FLAG_CHECKABLE);
     lv_obj_set_grid_cell(play_obj, LV_GRID_ALIGN_CENTER, 3, 1, LV_GRID_ALIGN_CENTER, 0, 1);
 
     lv_obj_add_event_cb(play_obj, play_event_click_cb, LV_EVENT_CLICKED, NULL);
     lv_obj_add_flag(play_obj, LV_OBJ_FLAG_CLICKABLE);
-    lv_obj_set_width(play_obj, img_lv_demo_music_btn_play.header.w);
+    lv_obj_set_width(play_obj, LV_DEMO_IMG(img_lv_demo_music_btn_play)->header.w);
 
     icon = lv_img_create(cont);
-    lv_img_set_src(icon, &img_lv_demo_music_btn_next);
+    lv_img_set_src(icon, LV_DEMO_IMG(img_lv_demo_music_btn_next));
     lv_obj_set_grid_cell(icon, LV_GRID_ALIGN_CENTER, 4, 1, LV_GRID_ALIGN_CENTER, 0, 1);
     lv_obj_add_event_cb(icon, next_click_event_cb, LV_EVENT_CLICKED, NULL);
     lv_obj_add_flag(icon, LV_OBJ_FLAG_CLICKABLE);
@@ -575,7 +576,7 @@ static lv_obj_t * create_ctrl_box(lv_obj_t * parent)
 #endif
     lv_obj_set_grid_cell(slider_obj, LV_GRID_ALIGN_STRETCH, 1, 4, LV_GRID_ALIGN_CENTER, 1, 1);
 
-    lv_obj_set_style_bg_img_src(slider_obj, &img_lv_demo_music_slider_knob, LV_PART_KNOB);
+    lv_obj_set_style_bg_img_src(slider_obj, LV_DEMO_IMG(img_lv_demo_music_slider_knob), LV_PART_KNOB);
     lv_obj_set_style_bg_opa(slider_obj, LV_OPA_TRANSP, LV_PART_KNOB);
     lv_obj_set_style_pad_all(slider_obj, 20, LV_PART_KNOB);
     lv_obj_set_style_bg_grad_dir(slider_obj, LV_GRAD_DIR_HOR, LV_PART_INDICATOR);
@@ -876,17 +877,17 @@ static lv_obj_t * album_img_create(lv_obj_t * parent)
 
     switch(track_id) {
     case 2:
-        lv_img_set_src(img, &img_lv_demo_music_cover_3);
+        lv_img_set_src(img, LV_DEMO_IMG(img_lv_demo_music_cover_3));
         spectrum = spectrum_3;
         spectrum_len = sizeof(spectrum_3) / sizeof(spectrum_3[0]);
         break;
     case 1:
-        lv_img_set_src(img, &img_lv_demo_music_cover_2);
+        lv_img_set_src(img, LV_DEMO_IMG(img_lv_demo_music_cover_2));
         spectrum = spectrum_2;
         spectrum_len = sizeof(spectrum_2) / sizeof(spectrum_2[0]);
         break;
     case 0:
-        lv_img_set_src(img, &img_lv_demo_music_cover_1);
+        lv_img_set_src(img, LV_DEMO_IMG(img_lv_demo_music_cover_1));
         spectrum = spectrum_1;
         spectrum_len = sizeof(spectrum_1) / sizeof(spectrum_1[0]);
         break;
@@ -13,6 +13,9 @@
  *      DEFINES
  *********************/
 #define TIME_STEP   50
+#define WARMUP_CYCLES   2       /*Not used for the leak trend as the first cycles fill caches too*/
+#define HIST_PROBE_MAX  256     /*Max. number of free blocks to measure for the histogram*/
+#define HIST_SIZE_MIN   64      /*The smaller free blocks go to the first bin without measuring them*/
 
 /**********************
  *      TYPEDEFS
@@ -27,6 +30,12 @@ static void set_y_anim(void * obj, int32_t v);
 static void set_width_anim(void * obj, int32_t v);
 static void arc_set_end_angle_anim(void * obj, int32_t v);
 static void obj_test_task_cb(lv_timer_t * tmr);
+static void cycle_add(const lv_mem_monitor_t * mon);
+static void stress_finish(lv_timer_t * tmr);
+static void leak_fit(void);
+static void free_hist_make(void);
+static void * free_block_take(uint32_t size);
+static uint32_t free_hist_bin(uint32_t size);
 
 /**********************
  *  STATIC VARIABLES
@@ -35,6 +44,10 @@ static lv_obj_t * main_page;
 static lv_obj_t * ta;
 static const char * mbox_btns[] = {"Ok", "Cancel", ""};
 static uint32_t mem_free_start = 0;
+static lv_demo_stress_finished_cb_t finished_cb;
+static lv_demo_stress_clock_cb_t clock_cb;
+static lv_demo_stress_result_t result;
+static lv_demo_stress_cycle_t cycles[LV_DEMO_STRESS_CYCLES + 1];     /*Not on LVGL's heap to not change what's measured*/
 /**********************
  *      MACROS
  **********************/
@@ -48,13 +61,50 @@ void lv_demo_stress(void)
     lv_timer_create(obj_test_task_cb, TIME_STEP, NULL);
 }
 
+void lv_demo_stress_set_finished_cb(lv_demo_stress_finished_cb_t cb)
+{
+    finished_cb = cb;
+}
+
+void lv_demo_stress_set_clock_cb(lv_demo_stress_clock_cb_t cb)
+{
+    clock_cb = cb;
+}
+
+void lv_demo_stress_get_result(lv_demo_stress_result_t * res)
+{
+    *res = result;
+}
+
+bool lv_demo_stress_get_cycle(uint32_t id, lv_demo_stress_cycle_t * cycle)
+{
+    if(id > result.cycle_cnt || id > LV_DEMO_STRESS_CYCLES) return false;
+
+    *cycle = cycles[id];
+    return true;
+}
+
+void _lv_demo_stress_finished(void)
+{
+    if(finished_cb) finished_cb();
+}
+
+/**
+ * Get the time for the measurements
+ * @return      the time from `clock_cb` or from the tick [us]
+ */
+uint32_t _lv_demo_stress_clock(void)
+{
+    if(clock_cb) return clock_cb();
+    else return lv_tick_get() * 1000;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
 static void obj_test_task_cb(lv_timer_t * tmr)
 {
-    (void) tmr;    /*Unused*/
     static int16_t state = -1;
 
     lv_anim_t a;
@@ -68,6 +118,7 @@ static void obj_test_task_cb(lv_timer_t * tmr)
             lv_res_t res = lv_mem_test();
             if(res != LV_RES_OK) {
                 LV_LOG_ERROR("Memory integrity error");
+                result.mem_error = true;
             }
 
             lv_mem_monitor_t mon;
@@ -75,7 +126,14 @@ static void obj_test_task_cb(lv_timer_t * tmr)
 
             if(mem_free_start == 0)  mem_free_start = mon.free_size;
 
-            LV_LOG_USER("mem leak since start: %d, frag: %3d %%",  mem_free_start - mon.free_size, mon.frag_pct);
+            LV_LOG_USER("cycle %d: mem leak since start: %d, frag: %3d %%, biggest free: %d", result.cycle_cnt,
+                        mem_free_start - mon.free_size, mon.frag_pct, mon.free_biggest_size);
+
+            cycle_add(&mon);
+            if(LV_DEMO_STRESS_CYCLES && result.cycle_cnt == LV_DEMO_STRESS_CYCLES) {
+                stress_finish(tmr);
+                return;
+            }
         }
             break;
         case 0:
@@ -414,6 +472,7 @@ static void obj_test_task_cb(lv_timer_t * tmr)
             lv_obj_clean(lv_scr_act());
             main_page = NULL;
             state = -2;
+            result.cycle_cnt++;
             break;
         default:
             break;
@@ -423,6 +482,140 @@ static void obj_test_task_cb(lv_timer_t * tmr)
     state ++;
 }
 
+/**
+ * Save the state of the heap after `result.cycle_cnt` cycles
+ */
+static void cycle_add(const lv_mem_monitor_t * mon)
+{
+    if(result.cycle_cnt > LV_DEMO_STRESS_CYCLES) return;
+
+    lv_demo_stress_cycle_t * c = &cycles[result.cycle_cnt];
+    c->free_size = mon->free_size;
+    c->free_biggest_size = mon->free_biggest_size;
+    c->used_cnt = mon->used_cnt;
+    c->frag_pct = mon->frag_pct;
+}
+
+/**
+ * Make a histogram of the free blocks' sizes after the last cycle. LVGL's heap can't be walked from here,
+ * but `lv_mem_monitor()` tells the size of the largest free block. So it's allocated to see the next largest
+ * and so on. In the end all of them are freed and they merge back to the same free blocks.
+ * It changes the order of the free blocks and `max_used` of `lv_mem_monitor()` becomes about `LV_MEM_SIZE`,
+ * so it's done only once when all the cycles are measured and the peak is saved before it.
+ */
+static void free_hist_make(void)
+{
+    lv_memset_00(result.free_hist, sizeof(result.free_hist));
+    result.free_hist_skip = 0;
+
+#if LV_MEM_CUSTOM == 0
+    static void * probes[HIST_PROBE_MAX];   /*Not on the heap which is measured*/
+    uint32_t probe_cnt = 0;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    result.heap_peak = mon.max_used;
+
+    while(mon.free_cnt > 0 && mon.free_biggest_size >= HIST_SIZE_MIN && probe_cnt < HIST_PROBE_MAX) {
+        uint32_t size = mon.free_biggest_size;
+        uint32_t free_size_prev = mon.free_size;
+        void * p = free_block_take(size);
+        if(p == NULL) break;
+        probes[probe_cnt] = p;
+        probe_cnt++;
+
+        lv_mem_monitor(&mon);
+        /*Stop if only a part of a block was taken, else its rest would be counted as an other block*/
+        if(free_size_prev - mon.free_size < size) break;
+        result.free_hist[free_hist_bin(size)]++;
+    }
+
+    /*Only the small blocks remain if all the others were measured*/
+    if(mon.free_biggest_size < HIST_SIZE_MIN) result.free_hist[0] += mon.free_cnt;
+    else result.free_hist_skip = mon.free_cnt;
+
+    while(probe_cnt > 0) {
+        probe_cnt--;
+        lv_mem_free(probes[probe_cnt]);
+    }
+#endif
+}
+
+/**
+ * Allocate a whole free block
+ * @param size      size of the largest free block
+ * @return          pointer to the allocated block or NULL on error
+ */
+static void * free_block_take(uint32_t size)
+{
+    /*The allocator might need some slack to find the block (e.g. TLSF rounds up the size to its size class).
+     *So allocate a bit less and grow it in place to the whole block.*/
+    void * p = lv_mem_alloc(size - size / 8);
+    if(p == NULL) return NULL;
+
+    void * p_whole = lv_mem_realloc(p, size);
+    return p_whole ? p_whole : p;
+}
+
+static uint32_t free_hist_bin(uint32_t size)
+{
+    uint32_t bin = 0;
+    while(size >= HIST_SIZE_MIN && bin < LV_DEMO_STRESS_HIST_BINS - 1) {
+        size >>= 1;
+        bin++;
+    }
+    return bin;
+}
+
+static void stress_finish(lv_timer_t * tmr)
+{
+    lv_timer_del(tmr);
+
+    free_hist_make();
+
+    leak_fit();
+    result.passed = !result.mem_error && result.leak_rate <= LV_DEMO_STRESS_LEAK_LIMIT;
+
+#if LV_MEM_CUSTOM
+    LV_LOG_WARN("the leak trend needs LVGL's heap (LV_MEM_CUSTOM 0)");
+#endif
+    LV_LOG_USER("%s: %d cycles, leak: %d bytes / 1000 cycles (limit: %d), %d bytes after the warm up%s",
+                result.passed ? "PASSED" : "FAILED", result.cycle_cnt, result.leak_rate, LV_DEMO_STRESS_LEAK_LIMIT,
+                result.leak_total, result.mem_error ? ", memory integrity error" : "");
+
+    _lv_demo_stress_finished();
+}
+
+/**
+ * Fit a line to the used memory after the warm up with least squares. A single number can be noise
+ * (e.g. a cache filled in the last cycle) but a slow leak shows up as a steady slope.
+ * With x = 0 ... n - 1 the sums of x have closed forms, so the slope is
+ * (12 * sum(x * y) - 6 * (n - 1) * sum(y)) / (n * (n^2 - 1)).
+ */
+static void leak_fit(void)
+{
+    uint32_t last = LV_MIN(result.cycle_cnt, LV_DEMO_STRESS_CYCLES);
+    uint32_t first = LV_MIN(WARMUP_CYCLES, last);
+    result.leak_total = (int32_t)((int64_t)cycles[first].free_size - cycles[last].free_size);
+
+    int64_t n = last - first + 1;
+    if(n < 2) return;
+
+    int64_t sum_y = 0;
+    int64_t sum_xy = 0;
+    int64_t x;
+    for(x = 0; x < n; x++) {
+        int64_t y = (int64_t)cycles[first].free_size - cycles[first + x].free_size;
+        sum_y += y;
+        sum_xy += x * y;
+    }
+
+    int64_t num = 12 * sum_xy - 6 * (n - 1) * sum_y;
+    int64_t den = n * (n * n - 1);
+    /*Scale to 1000 cycles in two parts to not overflow*/
+    result.leak_rate = (int32_t)((num / den) * 1000 + ((num % den) * 1000) / den);
+}
+
 static void auto_del(lv_obj_t * obj, uint32_t delay)
 {
     lv_anim_t a;
@@ -17,16 +17,174 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+#ifndef LV_DEMO_STRESS_CYCLES
+#define LV_DEMO_STRESS_CYCLES       0
+#endif
+
+#ifndef LV_DEMO_STRESS_LEAK_LIMIT
+#define LV_DEMO_STRESS_LEAK_LIMIT   100
+#endif
+
+/*Max. depth of the deep trees of `lv_demo_stress_tree()`, the deeper ones are skipped.
+ *Deleting, layout and event bubbling are recursive in LVGL, so every level needs a few hundred bytes of stack.*/
+#ifndef LV_DEMO_STRESS_TREE_DEPTH_MAX
+#define LV_DEMO_STRESS_TREE_DEPTH_MAX   1000
+#endif
+
+/*Bins of the free block histogram: < 64, < 128, < 256 ... < 64k, >= 64k bytes*/
+#define LV_DEMO_STRESS_HIST_BINS    12
 
 /**********************
  *      TYPEDEFS
  **********************/
+typedef void (*lv_demo_stress_finished_cb_t)(void);
+
+/*Return a time in microseconds. Only the difference of two calls is used so it can overflow.*/
+typedef uint32_t (*lv_demo_stress_clock_cb_t)(void);
+
+/*The heap after a cycle*/
+typedef struct {
+    uint32_t free_size;         /*Free memory [bytes]*/
+    uint32_t free_biggest_size; /*The largest free block [bytes]*/
+    uint32_t used_cnt;          /*Number of allocated blocks*/
+    uint8_t frag_pct;
+} lv_demo_stress_cycle_t;
+
+typedef struct {
+    uint32_t cycle_cnt;         /*Number of finished cycles*/
+    int32_t leak_total;         /*Used memory after the last cycle minus after the warm up [bytes]*/
+    int32_t leak_rate;          /*Slope of the line fitted to the used memory after the warm up [bytes / 1000 cycles]*/
+    uint32_t heap_peak;         /*`max_used` of `lv_mem_monitor()` after the last cycle, before the histogram [bytes]*/
+    uint16_t free_hist[LV_DEMO_STRESS_HIST_BINS];   /*Number of free blocks per size after the last cycle
+                                                     *(see LV_DEMO_STRESS_HIST_BINS)*/
+    uint16_t free_hist_skip;    /*Free blocks which are not in the histogram as they couldn't be measured*/
+    bool mem_error;             /*`lv_mem_test()` failed in a cycle*/
+    bool passed;                /*No memory error and `leak_rate <= LV_DEMO_STRESS_LEAK_LIMIT`*/
+} lv_demo_stress_result_t;
+
+typedef struct {
+    uint32_t seed;
+    uint32_t op_cnt;            /*Number of executed operations*/
+    uint32_t mem_test_cnt;      /*Number of `lv_mem_test()` calls*/
+    uint32_t mem_error_op;      /*Number of executed operations when `lv_mem_test()` failed first*/
+    bool mem_error;
+    int32_t leak_total;         /*Free memory before the first operation minus after deleting all the objects [bytes]*/
+    uint8_t frag_pct;           /*Fragmentation after deleting all the objects*/
+} lv_demo_stress_fuzz_result_t;
+
+typedef struct {
+    const char * name;          /*Name of the widget type*/
+    uint32_t cnt;               /*Number of created and deleted instances*/
+    uint32_t create_time;       /*Time of creating all the instances [us]*/
+    uint32_t del_time;          /*Time of deleting all the instances [us]*/
+    uint32_t create_per_sec;    /*Created instances per second*/
+    uint32_t size;              /*Used memory per instance [bytes]*/
+    uint32_t alloc_cnt;         /*Allocated blocks per instance*/
+} lv_demo_stress_widget_result_t;
+
+typedef struct {
+    uint32_t obj_cnt;           /*Number of objects in the tree*/
+    bool deep;                  /*true: a parent chain, false: all objects are the children of one object*/
+    bool skipped;               /*Larger than the limit, deeper than `LV_DEMO_STRESS_TREE_DEPTH_MAX` or probably doesn't fit into the heap*/
+    uint32_t sample_cnt;        /*The per object operations were measured on this many objects*/
+    uint32_t create_time;       /*Time of building the tree [us]*/
+    uint32_t layout_time;       /*Time of the first `lv_obj_update_layout()` which gives the objects their coordinates [us]*/
+    uint32_t get_child_time;    /*Time of `lv_obj_get_child()` on the sampled objects [us]*/
+    uint32_t get_child_id_time; /*Time of `lv_obj_get_child_id()` on the sampled objects [us]*/
+    uint32_t invalidate_time;   /*Time of `lv_obj_invalidate()` on the sampled objects [us]*/
+    uint32_t bubble_time;       /*Time of sending an event to the sampled objects which bubbles up to the root [us]*/
+    uint32_t clean_time;        /*Time of `lv_obj_clean()` on the tree [us]*/
+    uint32_t del_time;          /*Time of deleting the tree [us]*/
+    uint32_t obj_size;          /*Used memory per object [bytes]*/
+} lv_demo_stress_tree_result_t;
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 void lv_demo_stress(void);
 
+/**
+ * Run random operations (create, delete, async delete, style, layout, scroll, text edit, animation)
+ * on random objects instead of the fixed sequence of `lv_demo_stress()`.
+ * The same seed gives the same operations, so a failure can be replayed with it.
+ * The heap is checked with `lv_mem_test()` periodically.
+ * @param seed      seed of the random numbers
+ * @param op_cnt    finish after this many operations, 0: run forever
+ */
+void lv_demo_stress_fuzz(uint32_t seed, uint32_t op_cnt);
+
+/**
+ * Get the result of the fuzz test. Can be used when the fuzz test is finished.
+ * @param res   store the result here
+ */
+void lv_demo_stress_fuzz_get_result(lv_demo_stress_fuzz_result_t * res);
+
+/**
+ * Create and delete `cnt` instances of every widget type used by `lv_demo_stress()` (tabview, colorwheel, win,
+ * calendar, keyboard, dropdown, roller, chart, spinbox, msgbox, tileview, list) in a tight loop, one type in a step.
+ * The creation and deletion times and the memory per instance are measured and logged.
+ * @param cnt       instances to create of every widget type
+ */
+void lv_demo_stress_widgets(uint32_t cnt);
+
+/**
+ * Get the result of a widget type of `lv_demo_stress_widgets()`. Can be used when the test is finished.
+ * @param id    index of the widget type
+ * @param res   store the result here
+ * @return      false: `id` is too large or the widget type is not measured yet
+ */
+bool lv_demo_stress_widgets_get_result(uint32_t id, lv_demo_stress_widget_result_t * res);
+
+/**
+ * Build wide (all objects are children of one object) and deep (a parent chain) trees of 1000, 10000 and 50000
+ * objects, one tree in a step. Measure the building, the layout, `lv_obj_get_child()`, `lv_obj_get_child_id()`,
+ * invalidation, event bubbling, `lv_obj_clean()` and the deletion on each.
+ * The deep trees need stack in proportion to their depth as some functions of LVGL are recursive,
+ * so the ones deeper than `LV_DEMO_STRESS_TREE_DEPTH_MAX` are skipped.
+ * @param obj_cnt_max   skip the trees with more objects, 0: no limit
+ */
+void lv_demo_stress_tree(uint32_t obj_cnt_max);
+
+/**
+ * Get the result of a tree of `lv_demo_stress_tree()`. Can be used when the test is finished.
+ * @param id    index of the tree: the wide trees from the smallest, then the deep ones
+ * @param res   store the result here
+ * @return      false: `id` is too large or the tree is not measured yet
+ */
+bool lv_demo_stress_tree_get_result(uint32_t id, lv_demo_stress_tree_result_t * res);
+
+/**
+ * Set a more precise clock for the time measurements of `lv_demo_stress_widgets()` and `lv_demo_stress_tree()`.
+ * By default `lv_tick_get()` is used which has only millisecond resolution.
+ * @param clock_cb      pointer to a callback or NULL to use `lv_tick_get()`
+ */
+void lv_demo_stress_set_clock_cb(lv_demo_stress_clock_cb_t clock_cb);
+
+/**
+ * Set a callback to call when `LV_DEMO_STRESS_CYCLES` cycles, the operations of the fuzz test,
+ * the widget test or the tree test are ready and the result is logged
+ * @param finished_cb   pointer to a callback or NULL
+ */
+void lv_demo_stress_set_finished_cb(lv_demo_stress_finished_cb_t finished_cb);
+
+/**
+ * Get the result of the memory check. Can be used when the stress test is finished.
+ * @param res   store the result here
+ */
+void lv_demo_stress_get_result(lv_demo_stress_result_t * res);
+
+/**
+ * Get the state of the heap after a cycle. Only the first `LV_DEMO_STRESS_CYCLES` cycles are stored.
+ * @param id    index of the cycle. 0: before the first cycle, 1: after the first cycle...
+ * @param cycle store the heap's state here
+ * @return      false: the cycle is not ready or not stored
+ */
+bool lv_demo_stress_get_cycle(uint32_t id, lv_demo_stress_cycle_t * cycle);
+
+void _lv_demo_stress_finished(void);
+
+uint32_t _lv_demo_stress_clock(void);
+
 /**********************
  *      MACROS
  **********************/
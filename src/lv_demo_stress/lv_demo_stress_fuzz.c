@@ -0,0 +1,455 @@
+/**
+ * @file lv_demo_stress_fuzz.c
+ * Random operations on random objects. The random numbers come only from the seed,
+ * so with the same seed (and the virtual tick of the runner) a run can be replayed exactly.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_demo.h"
+#include "lv_demo_stress.h"
+
+#if LV_USE_DEMO_STRESS
+
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TIME_STEP           50
+#define OPS_PER_STEP        4
+#define OBJ_MAX             48      /*Max. number of objects created by the fuzzer at the same time*/
+#define MEM_TEST_PERIOD     32      /*Check the heap after this many operations*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const char * name;
+    bool (*exec_cb)(void);      /*Return false to end the step, e.g. to let an async delete happen*/
+    uint8_t weight;
+} fuzz_op_t;
+
+typedef lv_obj_t * (*create_cb_t)(lv_obj_t * parent);
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void fuzz_step_cb(lv_timer_t * tmr);
+static void fuzz_finish(lv_timer_t * tmr);
+static void mem_check(void);
+static bool op_create(void);
+static bool op_del(void);
+static bool op_del_async(void);
+static bool op_style(void);
+static bool op_layout(void);
+static bool op_scroll(void);
+static bool op_text(void);
+static bool op_anim(void);
+static lv_obj_t * obj_add(lv_obj_t * obj);
+static void obj_del_event_cb(lv_event_t * e);
+static lv_obj_t * rnd_obj(void);
+static const char * rnd_text(void);
+static uint32_t rnd(void);
+static int32_t rnd_range(int32_t min, int32_t max);
+static void set_x_anim(void * obj, int32_t v);
+static void set_y_anim(void * obj, int32_t v);
+static void set_width_anim(void * obj, int32_t v);
+static void set_height_anim(void * obj, int32_t v);
+static void set_opa_anim(void * obj, int32_t v);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const fuzz_op_t ops[] = {
+    {"create",          op_create,      6},
+    {"delete",          op_del,         2},
+    {"async delete",    op_del_async,   1},
+    {"style",           op_style,       3},
+    {"layout",          op_layout,      2},
+    {"scroll",          op_scroll,      2},
+    {"text",            op_text,        3},
+    {"animation",       op_anim,        2},
+};
+
+static const create_cb_t create_cbs[] = {
+    lv_obj_create, lv_btn_create, lv_label_create, lv_slider_create, lv_bar_create, lv_switch_create,
+    lv_checkbox_create, lv_textarea_create, lv_dropdown_create, lv_roller_create, lv_arc_create,
+};
+
+static const char * text_parts[] = {
+    "", " ", "\n", "Hello", "0123456789", LV_SYMBOL_OK, LV_SYMBOL_CLOSE LV_SYMBOL_WIFI,
+    "A longer text which should wrap in the smaller objects",
+};
+
+static const char * options[] = {
+    "One", "Zero\nOne\nTwo\nThree", "A\nB\nC\nD\nE\nF\nG\nH\nI\nJ\nK\nL", "Very long option to scroll\nShort",
+};
+
+static lv_obj_t * root;
+static lv_obj_t * objs[OBJ_MAX];
+static uint32_t obj_cnt;
+static uint32_t op_cnt_max;
+static uint32_t rnd_state;
+static uint32_t free_start;
+static char text_buf[128];
+static lv_demo_stress_fuzz_result_t result;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_demo_stress_fuzz(uint32_t seed, uint32_t op_cnt)
+{
+    lv_memset_00(&result, sizeof(result));
+    result.seed = seed;
+    op_cnt_max = op_cnt;
+    rnd_state = seed ? seed : 0x9E3779B9;     /*xorshift would stay 0*/
+    obj_cnt = 0;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    free_start = mon.free_size;
+
+    /*Log it to replay a failed run*/
+    LV_LOG_USER("fuzz seed: %d", seed);
+
+    root = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(root, LV_PCT(100), LV_PCT(100));
+
+    lv_timer_create(fuzz_step_cb, TIME_STEP, NULL);
+}
+
+void lv_demo_stress_fuzz_get_result(lv_demo_stress_fuzz_result_t * res)
+{
+    *res = result;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void fuzz_step_cb(lv_timer_t * tmr)
+{
+    /*Finish in a new step to let the last async delete happen*/
+    if(op_cnt_max && result.op_cnt >= op_cnt_max) {
+        fuzz_finish(tmr);
+        return;
+    }
+
+    uint32_t weight_sum = 0;
+    uint32_t i;
+    for(i = 0; i < sizeof(ops) / sizeof(ops[0]); i++) weight_sum += ops[i].weight;
+
+    uint32_t step;
+    for(step = 0; step < OPS_PER_STEP; step++) {
+        uint32_t r = rnd() % weight_sum;
+        for(i = 0; r >= ops[i].weight; i++) r -= ops[i].weight;
+
+        LV_LOG_TRACE("op %d: %s", result.op_cnt, ops[i].name);
+        bool cont = ops[i].exec_cb();
+        result.op_cnt++;
+
+        if(result.op_cnt % MEM_TEST_PERIOD == 0) mem_check();
+        if(!cont || (op_cnt_max && result.op_cnt >= op_cnt_max)) break;
+    }
+}
+
+static void fuzz_finish(lv_timer_t * tmr)
+{
+    lv_timer_del(tmr);
+
+    /*Delete everything to see what remains allocated*/
+    lv_obj_del(root);
+    root = NULL;
+    mem_check();
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    result.leak_total = (int32_t)((int64_t)free_start - mon.free_size);
+    result.frag_pct = mon.frag_pct;
+
+    LV_LOG_USER("fuzz %s: seed %d, %d operations, %d heap checks, %d bytes not freed, frag: %d %%",
+                result.mem_error ? "FAILED" : "ready", result.seed, result.op_cnt, result.mem_test_cnt,
+                result.leak_total, result.frag_pct);
+
+    _lv_demo_stress_finished();
+}
+
+static void mem_check(void)
+{
+    result.mem_test_cnt++;
+    if(lv_mem_test() == LV_RES_OK || result.mem_error) return;
+
+    result.mem_error = true;
+    result.mem_error_op = result.op_cnt;
+    LV_LOG_ERROR("Memory integrity error after %d operations, replay with seed %d", result.op_cnt, result.seed);
+}
+
+static bool op_create(void)
+{
+    if(obj_cnt >= OBJ_MAX) return op_del();
+
+    /*Build a tree, not only a flat list*/
+    lv_obj_t * parent = rnd() % 2 ? rnd_obj() : root;
+    if(parent == NULL) parent = root;
+
+    lv_obj_t * obj = create_cbs[rnd() % (sizeof(create_cbs) / sizeof(create_cbs[0]))](parent);
+    lv_obj_set_pos(obj, rnd_range(-20, 300), rnd_range(-20, 300));
+    if(rnd() % 2) lv_obj_set_size(obj, rnd_range(0, 300), rnd_range(0, 200));
+    obj_add(obj);
+    return true;
+}
+
+static bool op_del(void)
+{
+    lv_obj_t * obj = rnd_obj();
+    if(obj) lv_obj_del(obj);
+    return true;
+}
+
+static bool op_del_async(void)
+{
+    lv_obj_t * obj = rnd_obj();
+    if(obj == NULL) return true;
+
+    /*Nothing else can be deleted until the async delete happens, else it might delete a deleted object*/
+    lv_obj_del_async(obj);
+    return false;
+}
+
+static bool op_style(void)
+{
+    lv_obj_t * obj = rnd_obj();
+    if(obj == NULL) return true;
+
+    static const lv_style_selector_t selectors[] = {
+        LV_PART_MAIN, LV_PART_MAIN | LV_STATE_PRESSED, LV_PART_INDICATOR, LV_PART_KNOB | LV_STATE_CHECKED,
+    };
+    lv_style_selector_t sel = selectors[rnd() % (sizeof(selectors) / sizeof(selectors[0]))];
+
+    switch(rnd() % 8) {
+        case 0:
+            lv_obj_set_style_bg_color(obj, lv_color_hex(rnd()), sel);
+            break;
+        case 1:
+            lv_obj_set_style_bg_opa(obj, rnd() % 256, sel);
+            break;
+        case 2:
+            lv_obj_set_style_border_width(obj, rnd_range(0, 10), sel);
+            break;
+        case 3:
+            lv_obj_set_style_radius(obj, rnd() % 2 ? LV_RADIUS_CIRCLE : rnd_range(0, 30), sel);
+            break;
+        case 4:
+            lv_obj_set_style_pad_all(obj, rnd_range(0, 30), sel);
+            break;
+        case 5:
+            lv_obj_set_style_text_color(obj, lv_color_hex(rnd()), sel);
+            break;
+        case 6:
+            lv_obj_add_state(obj, rnd() % 2 ? LV_STATE_CHECKED : LV_STATE_DISABLED);
+            break;
+        default:
+            lv_obj_clear_state(obj, LV_STATE_CHECKED | LV_STATE_DISABLED);
+            break;
+    }
+    return true;
+}
+
+static bool op_layout(void)
+{
+    lv_obj_t * obj = rnd() % 4 ? rnd_obj() : root;
+    if(obj == NULL) obj = root;
+
+    static const lv_flex_flow_t flows[] = {
+        LV_FLEX_FLOW_ROW, LV_FLEX_FLOW_COLUMN, LV_FLEX_FLOW_ROW_WRAP, LV_FLEX_FLOW_COLUMN_WRAP,
+        LV_FLEX_FLOW_ROW_REVERSE, LV_FLEX_FLOW_COLUMN_WRAP_REVERSE,
+    };
+
+    switch(rnd() % 4) {
+        case 0:
+            lv_obj_set_flex_flow(obj, flows[rnd() % (sizeof(flows) / sizeof(flows[0]))]);
+            break;
+        case 1:
+            lv_obj_set_flex_align(obj, rnd() % 6, rnd() % 6, rnd() % 6);
+            break;
+        case 2:
+            lv_obj_set_size(obj, LV_SIZE_CONTENT, rnd() % 2 ? LV_SIZE_CONTENT : LV_PCT(rnd_range(10, 100)));
+            break;
+        default:
+            lv_obj_set_layout(obj, 0);
+            lv_obj_align(obj, rnd() % (LV_ALIGN_RIGHT_MID + 1), rnd_range(-20, 20), rnd_range(-20, 20));
+            break;
+    }
+    return true;
+}
+
+static bool op_scroll(void)
+{
+    lv_obj_t * obj = rnd_obj();
+    if(obj == NULL) obj = root;
+
+    if(rnd() % 2) lv_obj_scroll_by(obj, rnd_range(-200, 200), rnd_range(-200, 200), rnd() % 2);
+    else lv_obj_scroll_to_view_recursive(obj, rnd() % 2);
+    return true;
+}
+
+static bool op_text(void)
+{
+    lv_obj_t * obj = rnd_obj();
+    if(obj == NULL) return true;
+
+    if(lv_obj_check_type(obj, &lv_label_class)) {
+        lv_label_set_text(obj, rnd_text());
+    }
+    else if(lv_obj_check_type(obj, &lv_textarea_class)) {
+        switch(rnd() % 5) {
+            case 0:
+                lv_textarea_set_text(obj, rnd_text());
+                break;
+            case 1:
+                lv_textarea_add_text(obj, rnd_text());
+                break;
+            case 2:
+                lv_textarea_del_char(obj);
+                break;
+            case 3:
+                lv_textarea_set_cursor_pos(obj, rnd_range(-1, 100));
+                break;
+            default:
+                lv_textarea_set_one_line(obj, rnd() % 2);
+                break;
+        }
+    }
+    else if(lv_obj_check_type(obj, &lv_dropdown_class)) {
+        lv_dropdown_set_options(obj, options[rnd() % (sizeof(options) / sizeof(options[0]))]);
+        if(rnd() % 2) lv_dropdown_open(obj);
+    }
+    else if(lv_obj_check_type(obj, &lv_roller_class)) {
+        lv_roller_set_options(obj, options[rnd() % (sizeof(options) / sizeof(options[0]))],
+                              rnd() % 2 ? LV_ROLLER_MODE_INFINITE : LV_ROLLER_MODE_NORMAL);
+    }
+    else if(lv_obj_check_type(obj, &lv_checkbox_class)) {
+        lv_checkbox_set_text(obj, rnd_text());
+    }
+    else if(obj_cnt < OBJ_MAX) {
+        lv_obj_t * label = obj_add(lv_label_create(obj));
+        lv_label_set_text(label, rnd_text());
+    }
+    return true;
+}
+
+static bool op_anim(void)
+{
+    lv_obj_t * obj = rnd_obj();
+    if(obj == NULL) return true;
+
+    static const lv_anim_exec_xcb_t exec_cbs[] = {
+        set_x_anim, set_y_anim, set_width_anim, set_height_anim, set_opa_anim,
+    };
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_exec_cb(&a, exec_cbs[rnd() % (sizeof(exec_cbs) / sizeof(exec_cbs[0]))]);
+    lv_anim_set_values(&a, rnd_range(0, 255), rnd_range(0, 255));
+    lv_anim_set_time(&a, rnd_range(0, TIME_STEP * 10));
+    lv_anim_set_delay(&a, rnd_range(0, TIME_STEP * 2));
+    if(rnd() % 2) lv_anim_set_playback_time(&a, rnd_range(0, TIME_STEP * 5));
+    lv_anim_set_repeat_count(&a, rnd_range(0, 3));
+    lv_anim_start(&a);
+    return true;
+}
+
+/**
+ * Track an object to use it in the later operations. It's forgotten when it's deleted in any way
+ * (directly, with its parent, asynchronously).
+ */
+static lv_obj_t * obj_add(lv_obj_t * obj)
+{
+    objs[obj_cnt] = obj;
+    obj_cnt++;
+    lv_obj_add_event_cb(obj, obj_del_event_cb, LV_EVENT_DELETE, NULL);
+    return obj;
+}
+
+static void obj_del_event_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+    uint32_t i;
+    for(i = 0; i < obj_cnt; i++) {
+        if(objs[i] == obj) {
+            obj_cnt--;
+            objs[i] = objs[obj_cnt];
+            return;
+        }
+    }
+}
+
+static lv_obj_t * rnd_obj(void)
+{
+    if(obj_cnt == 0) return NULL;
+    return objs[rnd() % obj_cnt];
+}
+
+static const char * rnd_text(void)
+{
+    text_buf[0] = '\0';
+    uint32_t cnt = rnd() % 5;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        const char * part = text_parts[rnd() % (sizeof(text_parts) / sizeof(text_parts[0]))];
+        if(strlen(text_buf) + strlen(part) >= sizeof(text_buf)) break;
+        strcat(text_buf, part);
+    }
+    return text_buf;
+}
+
+/**
+ * xorshift32: fast and the same on every platform
+ */
+static uint32_t rnd(void)
+{
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state;
+}
+
+static int32_t rnd_range(int32_t min, int32_t max)
+{
+    return min + (int32_t)(rnd() % (uint32_t)(max - min + 1));
+}
+
+static void set_x_anim(void * obj, int32_t v)
+{
+    lv_obj_set_x(obj, v);
+}
+
+static void set_y_anim(void * obj, int32_t v)
+{
+    lv_obj_set_y(obj, v);
+}
+
+static void set_width_anim(void * obj, int32_t v)
+{
+    lv_obj_set_width(obj, v);
+}
+
+static void set_height_anim(void * obj, int32_t v)
+{
+    lv_obj_set_height(obj, v);
+}
+
+static void set_opa_anim(void * obj, int32_t v)
+{
+    lv_obj_set_style_opa(obj, v, 0);
+}
+
+#endif /*LV_USE_DEMO_STRESS*/
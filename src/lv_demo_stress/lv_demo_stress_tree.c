@@ -0,0 +1,255 @@
+/**
+ * @file lv_demo_stress_tree.c
+ * Build large wide (many children) and deep (long parent chain) object trees
+ * and measure the operations of the object model on them to see where they stop scaling.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_demo.h"
+#include "lv_demo_stress.h"
+
+#if LV_USE_DEMO_STRESS
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TIME_STEP       50
+#define SAMPLE_MAX      1000    /*Measure the per object operations on this many evenly spaced objects*/
+#define OBJ_SIZE        10      /*Not 0 to make the objects visible for the invalidation*/
+#define SIZE_CNT        (sizeof(sizes) / sizeof(sizes[0]))
+#define RUN_CNT         (2 * SIZE_CNT)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void tree_step_cb(lv_timer_t * tmr);
+static void tree_measure(lv_demo_stress_tree_result_t * res);
+static lv_obj_t * tree_build(uint32_t obj_cnt, bool deep);
+static lv_obj_t * obj_create(lv_obj_t * parent);
+static bool tree_fits(const lv_demo_stress_tree_result_t * res);
+static void root_event_cb(lv_event_t * e);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const uint32_t sizes[] = {1000, 10000, 50000};
+
+static lv_demo_stress_tree_result_t results[RUN_CNT];
+static uint32_t run_act;
+static uint32_t obj_cnt_limit;
+static lv_obj_t * root;
+static lv_obj_t * samples[SAMPLE_MAX];      /*Not on LVGL's heap to not change the measured memory*/
+static uint32_t sample_ids[SAMPLE_MAX];     /*Index of the samples in their parent*/
+static uint32_t sample_cnt;
+static uint32_t bubble_cnt;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_demo_stress_tree(uint32_t obj_cnt_max)
+{
+    lv_memset_00(results, sizeof(results));
+    run_act = 0;
+    obj_cnt_limit = obj_cnt_max ? obj_cnt_max : UINT32_MAX;
+
+    /*Visible to make the invalidations real, but the objects have no styles so drawing them is cheap*/
+    root = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(root);
+    lv_obj_set_size(root, LV_PCT(100), LV_PCT(100));
+    lv_obj_add_event_cb(root, root_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+
+    lv_timer_create(tree_step_cb, TIME_STEP, NULL);
+}
+
+bool lv_demo_stress_tree_get_result(uint32_t id, lv_demo_stress_tree_result_t * res)
+{
+    if(id >= run_act || id >= RUN_CNT) return false;
+
+    *res = results[id];
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void tree_step_cb(lv_timer_t * tmr)
+{
+    if(run_act < RUN_CNT) {
+        lv_demo_stress_tree_result_t * res = &results[run_act];
+        res->deep = run_act >= SIZE_CNT;
+        res->obj_cnt = sizes[run_act % SIZE_CNT];
+
+        if(res->deep && res->obj_cnt > LV_DEMO_STRESS_TREE_DEPTH_MAX) {
+            res->skipped = true;
+            LV_LOG_USER("deep tree of %d objects: skipped, deeper than LV_DEMO_STRESS_TREE_DEPTH_MAX", res->obj_cnt);
+        }
+        else if(res->obj_cnt > obj_cnt_limit || !tree_fits(res)) {
+            res->skipped = true;
+            LV_LOG_USER("%s tree of %d objects: skipped", res->deep ? "deep" : "wide", res->obj_cnt);
+        }
+        else {
+            tree_measure(res);
+        }
+
+        run_act++;
+        return;
+    }
+
+    lv_timer_del(tmr);
+    lv_obj_del(root);
+    root = NULL;
+
+    _lv_demo_stress_finished();
+}
+
+/**
+ * Build a tree, measure the operations on it, then clean it, build it again and delete it
+ * @param res       `deep` and `obj_cnt` tell the tree to build, the results are stored here too
+ */
+static void tree_measure(lv_demo_stress_tree_result_t * res)
+{
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    uint32_t t = _lv_demo_stress_clock();
+    lv_obj_t * top = tree_build(res->obj_cnt, res->deep);
+    res->create_time = _lv_demo_stress_clock() - t;
+    res->sample_cnt = sample_cnt;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    res->obj_size = (uint32_t)(((int64_t)mon_start.free_size - mon.free_size) / res->obj_cnt);
+
+    /*Until the layout the objects have empty coordinates and the invalidation would do nothing*/
+    t = _lv_demo_stress_clock();
+    lv_obj_update_layout(top);
+    res->layout_time = _lv_demo_stress_clock() - t;
+
+    uint32_t i;
+    t = _lv_demo_stress_clock();
+    for(i = 0; i < sample_cnt; i++) {
+        lv_obj_get_child(lv_obj_get_parent(samples[i]), sample_ids[i]);
+    }
+    res->get_child_time = _lv_demo_stress_clock() - t;
+
+    t = _lv_demo_stress_clock();
+    for(i = 0; i < sample_cnt; i++) {
+        lv_obj_get_child_id(samples[i]);
+    }
+    res->get_child_id_time = _lv_demo_stress_clock() - t;
+
+    t = _lv_demo_stress_clock();
+    for(i = 0; i < sample_cnt; i++) {
+        lv_obj_invalidate(samples[i]);
+    }
+    res->invalidate_time = _lv_demo_stress_clock() - t;
+
+    /*Every object of the tree has LV_OBJ_FLAG_EVENT_BUBBLE so the events travel up to the root*/
+    bubble_cnt = 0;
+    t = _lv_demo_stress_clock();
+    for(i = 0; i < sample_cnt; i++) {
+        lv_event_send(samples[i], LV_EVENT_VALUE_CHANGED, NULL);
+    }
+    res->bubble_time = _lv_demo_stress_clock() - t;
+    if(bubble_cnt != sample_cnt) LV_LOG_WARN("only %d of %d events reached the root", bubble_cnt, sample_cnt);
+
+    t = _lv_demo_stress_clock();
+    lv_obj_clean(top);
+    res->clean_time = _lv_demo_stress_clock() - t;
+    lv_obj_del(top);
+
+    /*Delete the whole tree like a screen*/
+    top = tree_build(res->obj_cnt, res->deep);
+    t = _lv_demo_stress_clock();
+    lv_obj_del(top);
+    res->del_time = _lv_demo_stress_clock() - t;
+
+    LV_LOG_USER("%s tree of %d objects: create: %d us, layout: %d us, clean: %d us, delete: %d us, %d bytes per object",
+                res->deep ? "deep" : "wide", res->obj_cnt, res->create_time, res->layout_time, res->clean_time,
+                res->del_time, res->obj_size);
+}
+
+/**
+ * Build a tree on `root` and sample its objects
+ * @param obj_cnt   number of objects under the top object
+ * @param deep      true: every object is the child of the previous one, false: all are the children of the top object
+ * @return          the top object of the tree
+ */
+static lv_obj_t * tree_build(uint32_t obj_cnt, bool deep)
+{
+    uint32_t stride = obj_cnt > SAMPLE_MAX ? obj_cnt / SAMPLE_MAX : 1;
+    sample_cnt = 0;
+
+    lv_obj_t * top = obj_create(root);
+    lv_obj_t * parent = top;
+    uint32_t i;
+    for(i = 0; i < obj_cnt; i++) {
+        lv_obj_t * obj = obj_create(parent);
+
+        if(i % stride == 0 && sample_cnt < SAMPLE_MAX) {
+            samples[sample_cnt] = obj;
+            sample_ids[sample_cnt] = deep ? 0 : i;
+            sample_cnt++;
+        }
+
+        if(deep) parent = obj;
+    }
+
+    return top;
+}
+
+/**
+ * Create a small plain object without the styles of the theme whose events bubble up to the root
+ */
+static lv_obj_t * obj_create(lv_obj_t * parent)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, OBJ_SIZE, OBJ_SIZE);
+    lv_obj_add_flag(obj, LV_OBJ_FLAG_EVENT_BUBBLE);
+    return obj;
+}
+
+/**
+ * Estimate the memory of a tree from the smaller tree of the same shape.
+ * An assert would stop everything if an object couldn't be allocated.
+ * @param res       the tree to build
+ * @return          true: the tree probably fits into the heap
+ */
+static bool tree_fits(const lv_demo_stress_tree_result_t * res)
+{
+#if LV_MEM_CUSTOM == 0
+    if(run_act % SIZE_CNT == 0) return true;
+
+    const lv_demo_stress_tree_result_t * prev = &results[run_act - 1];
+    if(prev->skipped) return false;
+
+    /*Keep some room for the children arrays which grow by reallocation*/
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return (uint64_t)res->obj_cnt * prev->obj_size * 5 / 4 < mon.free_size;
+#else
+    LV_UNUSED(res);
+    return true;
+#endif
+}
+
+static void root_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    bubble_cnt++;
+}
+
+#endif /*LV_USE_DEMO_STRESS*/
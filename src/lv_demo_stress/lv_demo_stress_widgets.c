@@ -0,0 +1,177 @@
+/**
+ * @file lv_demo_stress_widgets.c
+ * Create and delete many instances of the widgets of the stress test in a tight loop
+ * to see which ones are expensive to build.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../lv_demo.h"
+#include "lv_demo_stress.h"
+
+#if LV_USE_DEMO_STRESS
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TIME_STEP       50
+#define WIDGET_CNT      (sizeof(widgets) / sizeof(widgets[0]))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const char * name;
+    lv_obj_t * (*create_cb)(lv_obj_t * parent);
+} widget_dsc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void widget_step_cb(lv_timer_t * tmr);
+static void widget_measure(const widget_dsc_t * w, lv_demo_stress_widget_result_t * res);
+static lv_obj_t * tabview_create(lv_obj_t * parent);
+static lv_obj_t * colorwheel_create(lv_obj_t * parent);
+static lv_obj_t * win_create(lv_obj_t * parent);
+static lv_obj_t * msgbox_create(lv_obj_t * parent);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*The widgets of `lv_demo_stress()` with the same arguments*/
+static const widget_dsc_t widgets[] = {
+    {"tabview",     tabview_create},
+    {"colorwheel",  colorwheel_create},
+    {"win",         win_create},
+    {"calendar",    lv_calendar_create},
+    {"keyboard",    lv_keyboard_create},
+    {"dropdown",    lv_dropdown_create},
+    {"roller",      lv_roller_create},
+    {"chart",       lv_chart_create},
+    {"spinbox",     lv_spinbox_create},
+    {"msgbox",      msgbox_create},
+    {"tileview",    lv_tileview_create},
+    {"list",        lv_list_create},
+};
+
+static const char * mbox_btns[] = {"Ok", "Cancel", ""};
+
+static lv_demo_stress_widget_result_t results[WIDGET_CNT];
+static uint32_t widget_act;
+static uint32_t inst_cnt;
+static lv_obj_t * cont;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_demo_stress_widgets(uint32_t cnt)
+{
+    lv_memset_00(results, sizeof(results));
+    widget_act = 0;
+    inst_cnt = cnt ? cnt : 1;
+
+    /*Hidden to measure only the creation and not the rendering of the many instances*/
+    cont = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(cont, LV_PCT(100), LV_PCT(100));
+    lv_obj_add_flag(cont, LV_OBJ_FLAG_HIDDEN);
+
+    lv_timer_create(widget_step_cb, TIME_STEP, NULL);
+}
+
+bool lv_demo_stress_widgets_get_result(uint32_t id, lv_demo_stress_widget_result_t * res)
+{
+    if(id >= widget_act || id >= WIDGET_CNT) return false;
+
+    *res = results[id];
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void widget_step_cb(lv_timer_t * tmr)
+{
+    if(widget_act < WIDGET_CNT) {
+        widget_measure(&widgets[widget_act], &results[widget_act]);
+        widget_act++;
+        return;
+    }
+
+    lv_timer_del(tmr);
+    lv_obj_del(cont);
+    cont = NULL;
+
+    _lv_demo_stress_finished();
+}
+
+/**
+ * Create `inst_cnt` instances of a widget type and delete them
+ * @param w         the widget type
+ * @param res       store the result here
+ */
+static void widget_measure(const widget_dsc_t * w, lv_demo_stress_widget_result_t * res)
+{
+    res->name = w->name;
+    res->cnt = inst_cnt;
+
+    /*The first instance initializes e.g. the styles of the theme, don't measure it*/
+    lv_obj_del(w->create_cb(cont));
+
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+
+    uint32_t t = _lv_demo_stress_clock();
+    uint32_t i;
+    for(i = 0; i < inst_cnt; i++) {
+        w->create_cb(cont);
+    }
+    res->create_time = _lv_demo_stress_clock() - t;
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    res->size = (uint32_t)(((int64_t)mon_start.free_size - mon.free_size) / inst_cnt);
+    res->alloc_cnt = (mon.used_cnt - mon_start.used_cnt) / inst_cnt;
+
+    /*Delete from the end to not measure the shifting of the parent's child list*/
+    t = _lv_demo_stress_clock();
+    for(i = 0; i < inst_cnt; i++) {
+        lv_obj_del(lv_obj_get_child(cont, -1));
+    }
+    res->del_time = _lv_demo_stress_clock() - t;
+
+    /*0: too fast for the clock*/
+    res->create_per_sec = res->create_time ? (uint32_t)(((uint64_t)inst_cnt * 1000000) / res->create_time) : 0;
+
+    LV_LOG_USER("%s: %d created / s, create: %d us, delete: %d us, %d bytes and %d allocations per instance",
+                res->name, res->create_per_sec, res->create_time / inst_cnt, res->del_time / inst_cnt,
+                res->size, res->alloc_cnt);
+}
+
+static lv_obj_t * tabview_create(lv_obj_t * parent)
+{
+    return lv_tabview_create(parent, LV_DIR_TOP, 50);
+}
+
+static lv_obj_t * colorwheel_create(lv_obj_t * parent)
+{
+    return lv_colorwheel_create(parent, true);
+}
+
+static lv_obj_t * win_create(lv_obj_t * parent)
+{
+    return lv_win_create(parent, 50);
+}
+
+static lv_obj_t * msgbox_create(lv_obj_t * parent)
+{
+    return lv_msgbox_create(parent, "Title", "Some text on the message box with average length", mbox_btns, true);
+}
+
+#endif /*LV_USE_DEMO_STRESS*/